@@ -0,0 +1,126 @@
+/* counting allocator for bench/benchmark_memory.py. It is preloaded into the
+ * Python interpreter and replaces the malloc family of glibc, so every
+ * allocation of the interpreter, of the extension and of the C++ standard
+ * library (operator new uses malloc) is counted. The allocations are forwarded
+ * to the __libc_* functions, which avoids the recursion of looking up the next
+ * malloc with dlsym. The sizes are taken from malloc_usable_size, so the
+ * number of live bytes stays consistent when a block is freed.
+ *
+ * build:
+ *   g++ -O2 -std=c++11 -shared -fPIC bench/alloc_counter.cpp -o alloc_counter.so
+ *
+ * The counters are read with alloc_counter_read, which fills
+ *   [allocation count, allocated bytes, live bytes, peak live bytes]
+ * and the peak is reset to the current live bytes with alloc_counter_reset_peak.
+ */
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+std::atomic<uint64_t> g_count(0);
+std::atomic<uint64_t> g_bytes(0);
+std::atomic<uint64_t> g_live(0);
+std::atomic<uint64_t> g_peak(0);
+
+void on_alloc(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    uint64_t size = malloc_usable_size(ptr);
+    g_count.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    uint64_t live = g_live.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = g_peak.load(std::memory_order_relaxed);
+    while (live > peak && !g_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void on_free(void* ptr)
+{
+    if (ptr) {
+        g_live.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void* malloc(std::size_t size)
+{
+    void* ptr = __libc_malloc(size);
+    on_alloc(ptr);
+    return ptr;
+}
+
+void* calloc(std::size_t count, std::size_t size)
+{
+    void* ptr = __libc_calloc(count, size);
+    on_alloc(ptr);
+    return ptr;
+}
+
+void* realloc(void* ptr, std::size_t size)
+{
+    on_free(ptr);
+    void* result = __libc_realloc(ptr, size);
+    /* a failed realloc keeps the old block */
+    on_alloc(result ? result : (size ? ptr : nullptr));
+    return result;
+}
+
+void free(void* ptr)
+{
+    on_free(ptr);
+    __libc_free(ptr);
+}
+
+void* memalign(std::size_t alignment, std::size_t size)
+{
+    void* ptr = __libc_memalign(alignment, size);
+    on_alloc(ptr);
+    return ptr;
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size)
+{
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** result, std::size_t alignment, std::size_t size)
+{
+    void* ptr = memalign(alignment, size);
+    if (!ptr) {
+        return ENOMEM;
+    }
+    *result = ptr;
+    return 0;
+}
+
+void alloc_counter_read(uint64_t* counters)
+{
+    counters[0] = g_count.load();
+    counters[1] = g_bytes.load();
+    counters[2] = g_live.load();
+    counters[3] = g_peak.load();
+}
+
+void alloc_counter_reset_peak()
+{
+    g_peak.store(g_live.load());
+}
+
+} // extern "C"
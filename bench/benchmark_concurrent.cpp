@@ -0,0 +1,299 @@
+/* latency of concurrent searches from native threads. This is the native
+ * counterpart of bench/benchmark_concurrent.py: the threads are not limited by
+ * the GIL, so the results show how far the searches scale with the number of
+ * threads and where the tail latency grows because of shared caches or memory
+ * bandwidth. All threads search the same corpus of generated sentences:
+ *
+ *  - extractOne: WRatio with a cached query over all choices, raising the
+ *    score_cutoff like process.extractOne
+ *  - token_corpus_extractOne: TokenCorpus.extractOne with WRatio
+ *
+ * Every call is recorded in a log-linear histogram in the style of
+ * HdrHistogram, which is merged over all threads afterwards.
+ *
+ * build from the root of the repository:
+ *   g++ -O3 -std=c++11 -DNDEBUG -pthread -Isrc -Isrc/rapidfuzz-cpp $(python3-config --includes) \
+ *       bench/benchmark_concurrent.cpp src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp \
+ *       $(python3-config --ldflags --embed) -o benchmark_concurrent
+ *
+ * usage:
+ *   ./benchmark_concurrent [duration_s] [corpus_size]
+ * prints csv with the calls per second and the p50/p90/p99/p99.9 latencies
+ * in us for every search and thread count
+ */
+#include "cpp_process.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/* values below 2^precision_bits ns are stored exactly, larger ones with a
+ * relative error below 2^(1 - precision_bits). Same layout as
+ * bench/latency_histogram.py
+ */
+class LatencyHistogram {
+public:
+    static const unsigned precision_bits = 7;
+    static const uint64_t sub_buckets = uint64_t(1) << (precision_bits - 1);
+
+    LatencyHistogram() : m_total(0), m_max(0) {}
+
+    void record(uint64_t value)
+    {
+        std::size_t index = bucket_index(value);
+        if (index >= m_counts.size()) {
+            m_counts.resize(index + 1);
+        }
+        ++m_counts[index];
+        ++m_total;
+        m_max = std::max(m_max, value);
+    }
+
+    void merge(const LatencyHistogram& other)
+    {
+        if (other.m_counts.size() > m_counts.size()) {
+            m_counts.resize(other.m_counts.size());
+        }
+        for (std::size_t i = 0; i < other.m_counts.size(); ++i) {
+            m_counts[i] += other.m_counts[i];
+        }
+        m_total += other.m_total;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    uint64_t percentile(double q) const
+    {
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(m_total))));
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < m_counts.size(); ++i) {
+            seen += m_counts[i];
+            if (seen >= rank) {
+                return std::min(bucket_value(i), m_max);
+            }
+        }
+        return m_max;
+    }
+
+    uint64_t total() const
+    {
+        return m_total;
+    }
+
+private:
+    static unsigned bit_length(uint64_t value)
+    {
+        unsigned length = 0;
+        while (value) {
+            ++length;
+            value >>= 1;
+        }
+        return length;
+    }
+
+    static std::size_t bucket_index(uint64_t value)
+    {
+        unsigned length = bit_length(value);
+        if (length <= precision_bits) {
+            return static_cast<std::size_t>(value);
+        }
+        unsigned shift = length - precision_bits;
+        return static_cast<std::size_t>(shift * sub_buckets + (value >> shift));
+    }
+
+    /* highest value stored in the bucket */
+    static uint64_t bucket_value(std::size_t index)
+    {
+        if (index < 2 * sub_buckets) {
+            return index;
+        }
+        uint64_t shift = index / sub_buckets - 1;
+        uint64_t mantissa = index - shift * sub_buckets;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    std::vector<uint64_t> m_counts;
+    uint64_t m_total;
+    uint64_t m_max;
+};
+
+/* sentences of two to five words drawn from a fixed vocabulary, so the token
+ * based scorers see repeated tokens. The queries are choices with a few typos
+ */
+std::vector<std::string> generate_choices(std::size_t size, std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::uniform_int_distribution<std::size_t> word_length(2, 10);
+    std::vector<std::string> vocabulary(5000);
+    for (auto& word : vocabulary) {
+        std::size_t length = word_length(gen);
+        for (std::size_t i = 0; i < length; ++i) {
+            word += static_cast<char>(letter(gen));
+        }
+    }
+
+    std::uniform_int_distribution<std::size_t> word(0, vocabulary.size() - 1);
+    std::uniform_int_distribution<std::size_t> word_count(2, 5);
+    std::vector<std::string> choices(size);
+    for (auto& choice : choices) {
+        std::size_t count = word_count(gen);
+        for (std::size_t i = 0; i < count; ++i) {
+            choice += (i ? " " : "") + vocabulary[word(gen)];
+        }
+    }
+    return choices;
+}
+
+std::vector<std::string> generate_queries(const std::vector<std::string>& choices, std::size_t count,
+                                          std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<std::size_t> choice(0, choices.size() - 1);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::vector<std::string> queries;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string query = choices[choice(gen)];
+        std::uniform_int_distribution<std::size_t> pos(0, query.size() - 1);
+        query[pos(gen)] = static_cast<char>(letter(gen));
+        queries.push_back(query);
+    }
+    return queries;
+}
+
+proc_string to_proc_string(const std::string& str)
+{
+    return proc_string(RAPIDFUZZ_UINT8, false, (void*)str.data(), str.size());
+}
+
+/* prevents the compiler from removing the benchmarked calls */
+std::atomic<double> sink(0);
+
+struct Search {
+    const char* name;
+    double (*call)(const std::string& query);
+};
+
+std::vector<std::string> g_choices;
+std::vector<proc_string> g_proc_choices;
+detail::TokenCorpus g_corpus;
+
+double extract_one(const std::string& query)
+{
+    CachedScorerContext context = cached_WRatio_init(to_proc_string(query), 0);
+    double score_cutoff = 0;
+    double best = -1;
+    for (const auto& choice : g_proc_choices) {
+        double score = context.ratio(choice, score_cutoff);
+        if (score >= score_cutoff && score > best) {
+            best = score;
+            score_cutoff = score;
+            if (best == 100) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+double token_corpus_extract_one(const std::string& query)
+{
+    detail::TokenScorerStats stats;
+    std::vector<detail::TokenMatch> matches =
+        token_corpus_extract(g_corpus, to_proc_string(query), detail::TOKEN_WRATIO, 1, 0, stats);
+    return matches.empty() ? -1 : matches[0].score;
+}
+
+const Search searches[] = {
+    {"extractOne", extract_one},
+    {"token_corpus_extractOne", token_corpus_extract_one},
+};
+
+/* calls search from thread_count threads until duration passed, each thread
+ * starting at a different query
+ */
+LatencyHistogram run(const Search& search, const std::vector<std::string>& queries, std::size_t thread_count,
+                     double duration_s, double& elapsed_s)
+{
+    typedef std::chrono::steady_clock clock;
+    std::vector<LatencyHistogram> histograms(thread_count);
+    std::atomic<bool> start(false);
+    clock::time_point deadline;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            std::size_t i = t * queries.size() / thread_count;
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            double result = 0;
+            for (;;) {
+                clock::time_point before = clock::now();
+                result += search.call(queries[i]);
+                clock::time_point after = clock::now();
+                histograms[t].record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()));
+                if (after >= deadline) {
+                    break;
+                }
+                i = (i + 1) % queries.size();
+            }
+            sink.store(result);
+        });
+    }
+
+    clock::time_point begin = clock::now();
+    deadline = begin + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(duration_s));
+    start.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    elapsed_s = std::chrono::duration<double>(clock::now() - begin).count();
+
+    LatencyHistogram histogram;
+    for (const auto& h : histograms) {
+        histogram.merge(h);
+    }
+    return histogram;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double duration_s = (argc > 1) ? std::atof(argv[1]) : 2.0;
+    std::size_t corpus_size = (argc > 2) ? static_cast<std::size_t>(std::atol(argv[2])) : 10000;
+
+    std::mt19937_64 gen(42);
+    g_choices = generate_choices(corpus_size, gen);
+    std::vector<std::string> queries = generate_queries(g_choices, 1000, gen);
+    for (const auto& choice : g_choices) {
+        g_proc_choices.push_back(to_proc_string(choice));
+        token_corpus_add(g_corpus, g_proc_choices.back());
+    }
+    g_corpus.build();
+
+    const std::size_t thread_counts[] = {1, 2, 4, 8, 16};
+    std::printf("search,threads,calls,calls_per_s,p50_us,p90_us,p99_us,p999_us\n");
+    for (const Search& search : searches) {
+        search.call(queries[0]);
+        for (std::size_t thread_count : thread_counts) {
+            double elapsed_s = 0;
+            LatencyHistogram histogram = run(search, queries, thread_count, duration_s, elapsed_s);
+            std::printf("%s,%zu,%llu,%.1f,%.2f,%.2f,%.2f,%.2f\n", search.name, thread_count,
+                        static_cast<unsigned long long>(histogram.total()),
+                        static_cast<double>(histogram.total()) / elapsed_s,
+                        static_cast<double>(histogram.percentile(0.5)) / 1e3,
+                        static_cast<double>(histogram.percentile(0.9)) / 1e3,
+                        static_cast<double>(histogram.percentile(0.99)) / 1e3,
+                        static_cast<double>(histogram.percentile(0.999)) / 1e3);
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+"""
+measures the latency of process.extractOne and process.extract when they are
+called concurrently from a pool of Python threads against a shared corpus, as
+done by services answering requests from a thread pool. Every call is recorded
+in a LatencyHistogram, so the tail latencies are reported accurately. The
+TokenCorpus methods are benchmarked as well, since they release the GIL while
+scanning the corpus, while the process functions hold it.
+
+usage:
+  python benchmark_concurrent.py --kind names --size 10000 --threads 1 2 4 8 --duration 2
+
+For every function and thread count the throughput and the p50/p90/p99/p99.9
+latencies are printed and written to results/concurrent.csv. The histograms are
+written to results/concurrent.json. bench/benchmark_concurrent.cpp measures the
+same with native threads.
+"""
+import argparse
+import json
+import threading
+import time
+
+import pandas
+from rapidfuzz import fuzz, process
+
+from latency_histogram import LatencyHistogram
+from workloads import CORPORA, add_error_model_arguments, error_model_from_arguments, make_workload
+
+FUNCTIONS = ["extractOne", "extract", "TokenCorpus.extractOne", "TokenCorpus.extract"]
+
+
+def make_call(func, choices, corpus, scorer, limit, score_cutoff):
+    if func == "extractOne":
+        return lambda query: process.extractOne(query, choices, scorer=scorer, score_cutoff=score_cutoff)
+    if func == "extract":
+        return lambda query: process.extract(query, choices, scorer=scorer, limit=limit, score_cutoff=score_cutoff)
+    if func == "TokenCorpus.extractOne":
+        return lambda query: corpus.extractOne(query, scorer=scorer, score_cutoff=score_cutoff)
+    return lambda query: corpus.extract(query, scorer=scorer, limit=limit, score_cutoff=score_cutoff)
+
+
+def run(call, queries, threads, duration):
+    """
+    calls call from `threads` threads until duration seconds passed. Each thread
+    starts at a different query. Returns the merged histogram and the elapsed time
+    """
+    histograms = [LatencyHistogram() for _ in range(threads)]
+    start_barrier = threading.Barrier(threads + 1)
+    deadline = [0.0]
+
+    def worker(thread_id):
+        histogram = histograms[thread_id]
+        i = thread_id * len(queries) // threads
+        start_barrier.wait()
+        while True:
+            start = time.perf_counter_ns()
+            call(queries[i])
+            stop = time.perf_counter_ns()
+            histogram.record(stop - start)
+            if stop >= deadline[0]:
+                break
+            i = (i + 1) % len(queries)
+
+    workers = [threading.Thread(target=worker, args=(i,)) for i in range(threads)]
+    for thread in workers:
+        thread.start()
+    start = time.perf_counter_ns()
+    deadline[0] = start + int(duration * 1e9)
+    start_barrier.wait()
+    for thread in workers:
+        thread.join()
+    elapsed = time.perf_counter_ns() - start
+
+    histogram = LatencyHistogram()
+    for h in histograms:
+        histogram.merge(h)
+    return histogram, elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="benchmark the latency of concurrent calls")
+    parser.add_argument("--kind", choices=sorted(CORPORA), default="names")
+    parser.add_argument("--size", type=int, default=10000, help="size of the corpus (default: 10000)")
+    parser.add_argument("--threads", nargs="+", type=int, default=[1, 2, 4, 8, 16])
+    parser.add_argument("--functions", nargs="+", choices=FUNCTIONS, default=FUNCTIONS)
+    parser.add_argument("--scorer", default="WRatio", help="scorer from rapidfuzz.fuzz (default: WRatio)")
+    parser.add_argument("--limit", type=int, default=5, help="limit used for extract (default: 5)")
+    parser.add_argument("--score-cutoff", type=float, default=0)
+    parser.add_argument("--duration", type=float, default=2.0, help="seconds per configuration (default: 2)")
+    parser.add_argument("--queries", type=int, default=1000, help="distinct queries (default: 1000)")
+    parser.add_argument("--seed", type=int, default=18)
+    parser.add_argument("--output", default="results/concurrent", help="path of the results without extension")
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    scorer = getattr(fuzz, args.scorer)
+    choices, queries, _ = make_workload(args.kind, args.size, args.queries,
+        error_model_from_arguments(args), args.seed)
+    corpus = None
+    if any(func.startswith("TokenCorpus") for func in args.functions):
+        corpus = process.TokenCorpus(choices)
+
+    rows = []
+    histograms = []
+    for func in args.functions:
+        call = make_call(func, choices, corpus, scorer, args.limit, args.score_cutoff)
+        # warm up the caches
+        call(queries[0])
+
+        for threads in args.threads:
+            histogram, elapsed = run(call, queries, threads, args.duration)
+            row = {
+                "function": func, "threads": threads, "calls": histogram.total,
+                "calls_per_s": histogram.total / elapsed * 1e9,
+                "p50_ms": histogram.percentile(0.5) / 1e6,
+                "p90_ms": histogram.percentile(0.9) / 1e6,
+                "p99_ms": histogram.percentile(0.99) / 1e6,
+                "p999_ms": histogram.percentile(0.999) / 1e6,
+                "max_ms": histogram.max / 1e6
+            }
+            rows.append(row)
+            histograms.append({"function": func, "threads": threads, "buckets_ns": histogram.buckets()})
+            print(f"{func} threads={threads}: {row['calls_per_s']:.1f} calls/s, p50={row['p50_ms']:.3f}ms "
+                  f"p90={row['p90_ms']:.3f}ms p99={row['p99_ms']:.3f}ms p99.9={row['p999_ms']:.3f}ms "
+                  f"max={row['max_ms']:.3f}ms")
+
+    df = pandas.DataFrame(rows)
+    df.to_csv(args.output + ".csv", sep=',', index=False)
+    with open(args.output + ".json", "w") as f:
+        json.dump({
+            "workload": args.kind, "corpus_size": args.size, "scorer": args.scorer,
+            "limit": args.limit, "score_cutoff": args.score_cutoff, "histograms": histograms
+        }, f)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,101 @@
+"""
+measures how much memory forked workers stop sharing with their parent while
+they run searches. The parent creates the choices and a process.NativeCorpus
+of them and forks the workers, like gunicorn in the prefork model. Each
+worker runs the queries with process.extractOne on the list of choices or
+on the NativeCorpus and reports the growth of its private dirty memory from
+/proc/self/smaps_rollup, which are the pages copied on write. The reference
+counts changed by process.extract copy the pages of the choices, while the
+NativeCorpus is only read.
+
+gc.freeze is called before forking, so the garbage collector does not copy
+the pages of the objects created by the parent. This requires Linux.
+
+usage:
+  python benchmark_fork_sharing.py --sizes 100000 1000000 --workers 4
+
+The results are written to results/fork_sharing.csv and in the format of
+benchmark_results.py to results/fork_sharing.json
+"""
+import argparse
+import gc
+import json
+import os
+
+import pandas
+from rapidfuzz import fuzz, process
+
+from benchmark_results import BenchmarkResults
+from workloads import CORPORA, add_error_model_arguments, error_model_from_arguments, make_workload
+
+
+def private_dirty():
+    """private dirty memory of the process in bytes"""
+    with open("/proc/self/smaps_rollup") as f:
+        for line in f:
+            if line.startswith("Private_Dirty:"):
+                return int(line.split()[1]) * 1024
+    return 0
+
+
+def run_worker(search, queries):
+    """forks a worker running the queries and returns its private dirty growth"""
+    read_fd, write_fd = os.pipe()
+    pid = os.fork()
+    if pid == 0:
+        os.close(read_fd)
+        before = private_dirty()
+        for query in queries:
+            search(query)
+        with os.fdopen(write_fd, "w") as f:
+            f.write(json.dumps(private_dirty() - before))
+        os._exit(0)
+
+    os.close(write_fd)
+    with os.fdopen(read_fd) as f:
+        growth = json.loads(f.read())
+    os.waitpid(pid, 0)
+    return growth
+
+
+def main():
+    parser = argparse.ArgumentParser(description="benchmark the memory shared by forked workers")
+    parser.add_argument("--kind", choices=sorted(CORPORA), default="names")
+    parser.add_argument("--sizes", nargs="+", type=int, default=[100000, 1000000])
+    parser.add_argument("--workers", type=int, default=4, help="forked workers per configuration (default: 4)")
+    parser.add_argument("--queries", type=int, default=5, help="queries per worker (default: 5)")
+    parser.add_argument("--seed", type=int, default=18)
+    parser.add_argument("--output", default="results/fork_sharing", help="path of the results without extension")
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    error_model = error_model_from_arguments(args)
+    report = BenchmarkResults("fork_sharing")
+    rows = []
+
+    for size in args.sizes:
+        choices, queries, _ = make_workload(args.kind, size, args.queries, error_model, args.seed)
+        corpus = process.NativeCorpus(choices)
+        searches = {
+            "list": lambda query: process.extractOne(query, choices, scorer=fuzz.WRatio),
+            "NativeCorpus": lambda query: corpus.extractOne(query, scorer=fuzz.WRatio),
+        }
+
+        gc.collect()
+        gc.freeze()
+        for name, search in searches.items():
+            samples = [run_worker(search, queries) for _ in range(args.workers)]
+            params = {"workload": args.kind, "corpus_size": size}
+            report.add(f"private_dirty ({name})", params, samples, unit="B")
+            row = dict(params, corpus=name, private_dirty_bytes=sorted(samples)[len(samples) // 2])
+            rows.append(row)
+            print(f"{name} size={size}: {row['private_dirty_bytes'] / 2**20:.1f} MiB private dirty per worker")
+        gc.unfreeze()
+
+    df = pandas.DataFrame(rows)
+    df.to_csv(args.output + ".csv", sep=',', index=False)
+    report.write(args.output + ".json")
+
+
+if __name__ == "__main__":
+    main()
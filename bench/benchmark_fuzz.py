@@ -2,14 +2,17 @@
 import timeit
 import pandas
 import numpy as np
+from benchmark_results import BenchmarkResults
 
-def benchmark(name, func, setup, lengths, count):
+report = BenchmarkResults("fuzz")
+
+def benchmark(name, func, setup, lengths, count, **params):
     print(f"starting {name}")
     start = timeit.default_timer()
     results = []
     for length in lengths:
-        test = timeit.Timer(func, setup=setup.format(length, count))
-        results.append(min(test.timeit(number=1) for _ in range(7)) / count)
+        results.append(report.timeit(name, dict(params, length=length),
+            func, setup.format(length, count), count))
     stop = timeit.default_timer()
     print(f"finished {name}, Runtime: ", stop - start)
     return results
@@ -29,11 +32,11 @@ lengths = list(range(1,512,2))
 count = 1000
 
 def scorer_benchmark(funcname):
-    time_rapidfuzz = benchmark("rapidfuzz",
+    time_rapidfuzz = benchmark(f"{funcname} (rapidfuzz)",
         f'[rfuzz.{funcname}(a, b) for b in b_list]',
         setup, lengths, count)
 
-    time_fuzzywuzzy = benchmark("fuzzywuzzy",
+    time_fuzzywuzzy = benchmark(f"{funcname} (fuzzywuzzy)",
         f'[fuzz.{funcname}(a, b) for b in b_list]',
         setup, lengths, count)
     
@@ -59,7 +62,7 @@ time_token_ratio = benchmark("token_ratio",
     setup, lengths, count)
     
 # this gets very slow, so only benchmark it for smaller values
-time_token_ratio_simple = benchmark("fuzzywuzzy",
+time_token_ratio_simple = benchmark("max(token_sort_ratio, token_set_ratio)",
     f'[max(rfuzz.token_sort_ratio(a, b, processor=None), rfuzz.token_set_ratio(a, b, processor=None)) for b in b_list]',
     setup, lengths, count)
     
@@ -72,12 +75,12 @@ df = pandas.DataFrame(data={
 df.to_csv(f"results/token_ratio.csv", sep=',',index=False)
 
 # partial_token_ratio is unique to RapidFuzz
-time_partial_token_ratio = benchmark("token_ratio",
+time_partial_token_ratio = benchmark("partial_token_ratio",
     f'[rfuzz.partial_token_ratio(a, b, processor=None) for b in b_list]',
     setup, lengths, count)
     
 # this gets very slow, so only benchmark it for smaller values
-time_partial_token_ratio_simple = benchmark("fuzzywuzzy",
+time_partial_token_ratio_simple = benchmark("max(partial_token_sort_ratio, partial_token_set_ratio)",
     f'[max(rfuzz.partial_token_sort_ratio(a, b, processor=None), rfuzz.partial_token_set_ratio(a, b, processor=None)) for b in b_list]',
     setup, lengths, count)
     
@@ -87,4 +90,6 @@ df = pandas.DataFrame(data={
     "max(partial_token_sort_ratio, partial_token_set_ratio)": time_partial_token_ratio_simple,
 })
     
-df.to_csv(f"results/partial_token_ratio.csv", sep=',',index=False)
\ No newline at end of file
+df.to_csv(f"results/partial_token_ratio.csv", sep=',',index=False)
+
+report.write("results/fuzz.json")
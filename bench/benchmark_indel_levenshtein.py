@@ -2,14 +2,17 @@
 import timeit
 import pandas
 import numpy as np
+from benchmark_results import BenchmarkResults
 
-def benchmark(name, func, setup, lengths, count):
+report = BenchmarkResults("levenshtein_indel")
+
+def benchmark(name, func, setup, lengths, count, **params):
     print(f"starting {name}")
     start = timeit.default_timer()
     results = []
     for length in lengths:
-        test = timeit.Timer(func, setup=setup.format(length, count))
-        results.append(min(test.timeit(number=1) for _ in range(7)) / count)
+        results.append(report.timeit(name, dict(params, length=length),
+            func, setup.format(length, count), count))
     stop = timeit.default_timer()
     print(f"finished {name}, Runtime: ", stop - start)
     return results
@@ -44,3 +47,5 @@ df = pandas.DataFrame(data={
 })
 
 df.to_csv("results/levenshtein_indel.csv", sep=',',index=False)
+
+report.write("results/levenshtein_indel.json")
@@ -0,0 +1,62 @@
+import timeit
+import pandas
+import numpy as np
+from benchmark_results import BenchmarkResults
+
+report = BenchmarkResults("jaro_winkler")
+
+def benchmark(name, func, setup, lengths, count, **params):
+    print(f"starting {name}")
+    start = timeit.default_timer()
+    results = []
+    for length in lengths:
+        results.append(report.timeit(name, dict(params, length=length),
+            func, setup.format(length, count), count))
+    stop = timeit.default_timer()
+    print(f"finished {name}, Runtime: ", stop - start)
+    return results
+
+setup ="""
+from rapidfuzz import string_metric, process
+import Levenshtein
+import jellyfish
+import string
+import random
+random.seed(18)
+characters = string.ascii_letters + string.digits + string.whitespace + string.punctuation
+a = ''.join(random.choice(characters) for _ in range({0}))
+b_list = [''.join(random.choice(characters) for _ in range({0})) for _ in range({1})]
+"""
+
+lengths = list(range(1,2048,16))
+count = 1000
+
+time_rapidfuzz = benchmark("rapidfuzz",
+        '[string_metric.jaro_winkler_similarity(a, b) for b in b_list]',
+        setup, lengths, count)
+
+# uses the match vectors of the cached query
+time_rapidfuzz_extract = benchmark("rapidfuzz (process.extract)",
+        'process.extract(a, b_list, scorer=string_metric.jaro_winkler_similarity, limit=None)',
+        setup, lengths, count)
+
+# these get very slow, so only benchmark them for smaller values
+time_python_levenshtein = benchmark("python-Levenshtein",
+        '[Levenshtein.jaro_winkler(a, b) for b in b_list]',
+        setup, list(range(1,512,16)), count) + [np.NaN] * 96
+
+time_jellyfish = benchmark("jellyfish",
+        '[jellyfish.jaro_winkler_similarity(a, b) for b in b_list]',
+        setup, list(range(1,512,16)), count) + [np.NaN] * 96
+
+df = pandas.DataFrame(data={
+    "length": lengths,
+    "rapidfuzz": time_rapidfuzz,
+    "rapidfuzz (process.extract)": time_rapidfuzz_extract,
+    "python-Levenshtein": time_python_levenshtein,
+    "jellyfish": time_jellyfish,
+})
+
+df.to_csv("results/jaro_winkler.csv", sep=',',index=False)
+
+report.write("results/jaro_winkler.json")
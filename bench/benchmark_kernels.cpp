@@ -0,0 +1,632 @@
+/* micro benchmarks of the scorer kernels. The kernels are called directly,
+ * so the results do not include the argument parsing and conv_sequence
+ * overhead of the Python wrappers, which dominates the timeit benchmarks for
+ * short strings. Each function in cpp_scorer.hpp and each cached scorer in
+ * cpp_process.hpp is run on pairs of generated strings for a sweep of
+ * lengths, alphabet sizes and similarities. A fixed seed is used, so every
+ * run compares the same strings. The kernels scoring several choices in
+ * SIMD lanes (*_lanes_simd) are additionally run with scalar lanes and with
+ * one choice at a time, so the gain of the lanes is measured directly.
+ *
+ * build from the root of the repository:
+ *   g++ -O3 -std=c++11 -DNDEBUG -Isrc -Isrc/rapidfuzz-cpp $(python3-config --includes) \
+ *       bench/benchmark_kernels.cpp src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp \
+ *       $(python3-config --ldflags --embed) -o benchmark_kernels
+ *
+ * usage:
+ *   ./benchmark_kernels [--json] [filter]
+ * only kernels with a name containing filter are run. Every kernel is timed
+ * sample_count times and the results are printed as csv, or as json with
+ * --json, in the format of bench/benchmark_results.py, so the results of two
+ * builds can be compared with bench/compare_results.py. The compiler flags
+ * are only partially known from the predefined macros, the full command line
+ * can be recorded by defining BENCHMARK_BUILD_FLAGS as a string
+ */
+#include "cpp_scorer.hpp"
+#include "cpp_process.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::size_t pair_count = 32;
+const std::size_t sample_count = 11;
+const double min_sample_ns = 2e6;
+
+struct Sample {
+    std::vector<uint32_t> data1;
+    std::vector<uint32_t> data2;
+    std::vector<uint8_t> bytes1;
+    std::vector<uint8_t> bytes2;
+    bool wide;
+
+    proc_string s1() const
+    {
+        return wide ? proc_string(RAPIDFUZZ_UINT32, false, (void*)data1.data(), data1.size())
+                    : proc_string(RAPIDFUZZ_UINT8, false, (void*)bytes1.data(), bytes1.size());
+    }
+
+    proc_string s2() const
+    {
+        return wide ? proc_string(RAPIDFUZZ_UINT32, false, (void*)data2.data(), data2.size())
+                    : proc_string(RAPIDFUZZ_UINT8, false, (void*)bytes2.data(), bytes2.size());
+    }
+};
+
+struct Config {
+    std::size_t length;
+    std::size_t alphabet;
+    double similarity;
+};
+
+/* s2 is a copy of s1, with each character replaced by a random character
+ * with a probability of 1 - similarity. Alphabets with up to 256 characters
+ * are stored as uint8_t, larger ones as uint32_t, so the hashmaps of the
+ * pattern match vectors are used for them
+ */
+std::vector<Sample> generate(const Config& config, std::mt19937_64& gen)
+{
+    bool wide = config.alphabet > 256;
+    uint32_t first = wide ? 0x100 : (config.alphabet <= 26 ? 'a' : 0);
+    std::uniform_int_distribution<uint32_t> ch(first, first + static_cast<uint32_t>(config.alphabet) - 1);
+    std::uniform_real_distribution<double> keep(0.0, 1.0);
+
+    std::vector<Sample> samples(pair_count);
+    for (auto& sample : samples) {
+        sample.wide = wide;
+        for (std::size_t i = 0; i < config.length; ++i) {
+            uint32_t c1 = ch(gen);
+            uint32_t c2 = (keep(gen) < config.similarity) ? c1 : ch(gen);
+            sample.data1.push_back(c1);
+            sample.data2.push_back(c2);
+            sample.bytes1.push_back(static_cast<uint8_t>(c1));
+            sample.bytes2.push_back(static_cast<uint8_t>(c2));
+        }
+    }
+    return samples;
+}
+
+/* prevents the compiler from removing the benchmarked calls */
+volatile double sink;
+
+std::string cpu_model()
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            std::size_t pos = line.find(':');
+            if (pos != std::string::npos) {
+                pos = line.find_first_not_of(" \t", pos + 1);
+                return (pos == std::string::npos) ? std::string() : line.substr(pos);
+            }
+        }
+    }
+    return "unknown";
+}
+
+std::string build_flags()
+{
+    std::string flags;
+#if defined(__clang__)
+    flags += "clang " __clang_version__;
+#elif defined(__GNUC__)
+    flags += "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    flags += "msvc " + std::to_string(_MSC_VER);
+#endif
+#ifdef __OPTIMIZE__
+    flags += " optimize";
+#endif
+#ifdef NDEBUG
+    flags += " -DNDEBUG";
+#endif
+#ifdef __SSE2__
+    flags += " sse2";
+#endif
+#ifdef __AVX2__
+    flags += " avx2";
+#endif
+#ifdef __AVX512F__
+    flags += " avx512f";
+#endif
+#ifdef BENCHMARK_BUILD_FLAGS
+    flags += " " BENCHMARK_BUILD_FLAGS;
+#endif
+    return flags;
+}
+
+/* json and csv strings only need escaping for quotes and backslashes */
+std::string escape(const std::string& str, bool json)
+{
+    std::string result;
+    for (char c : str) {
+        if (c == '"' || (json && c == '\\')) {
+            result += json ? '\\' : '"';
+        }
+        result += c;
+    }
+    return result;
+}
+
+/* percentile with linear interpolation between the closest ranks */
+double percentile(const std::vector<double>& sorted, double q)
+{
+    double pos = static_cast<double>(sorted.size() - 1) * q;
+    std::size_t lower = static_cast<std::size_t>(pos);
+    std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (pos - static_cast<double>(lower));
+}
+
+class Reporter {
+public:
+    explicit Reporter(bool json)
+        : m_json(json), m_first(true), m_cpu_model(cpu_model()), m_build_flags(build_flags())
+    {
+        if (m_json) {
+            std::printf("{\n \"schema\": 1,\n \"suite\": \"kernels\",\n \"cpu_model\": \"%s\",\n"
+                        " \"build_flags\": \"%s\",\n \"results\": [",
+                        escape(m_cpu_model, true).c_str(), escape(m_build_flags, true).c_str());
+        } else {
+            std::printf("suite,kernel,params,median_ns,p10_ns,p90_ns,samples_ns,cpu_model,build_flags\n");
+        }
+    }
+
+    ~Reporter()
+    {
+        if (m_json) {
+            std::printf("\n ]\n}\n");
+        }
+    }
+
+    void report(const std::string& name, const Config& config, std::vector<double> samples)
+    {
+        std::vector<double> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        double median = percentile(sorted, 0.5);
+        double p10 = percentile(sorted, 0.1);
+        double p90 = percentile(sorted, 0.9);
+
+        if (m_json) {
+            std::printf("%s\n  {\"kernel\": \"%s\", \"params\": {\"alphabet\": %zu, \"length\": %zu, \"similarity\": %g},"
+                        " \"median_ns\": %.2f, \"p10_ns\": %.2f, \"p90_ns\": %.2f, \"samples_ns\": [",
+                        m_first ? "" : ",", name.c_str(), config.alphabet, config.length, config.similarity,
+                        median, p10, p90);
+            for (std::size_t i = 0; i < samples.size(); ++i) {
+                std::printf("%s%.2f", i ? ", " : "", samples[i]);
+            }
+            std::printf("]}");
+        } else {
+            std::printf("kernels,%s,alphabet=%zu;length=%zu;similarity=%g,%.2f,%.2f,%.2f,", name.c_str(),
+                        config.alphabet, config.length, config.similarity, median, p10, p90);
+            for (std::size_t i = 0; i < samples.size(); ++i) {
+                std::printf("%s%.2f", i ? " " : "", samples[i]);
+            }
+            std::printf(",\"%s\",\"%s\"\n", escape(m_cpu_model, false).c_str(), escape(m_build_flags, false).c_str());
+        }
+        m_first = false;
+        std::fflush(stdout);
+    }
+
+private:
+    bool m_json;
+    bool m_first;
+    std::string m_cpu_model;
+    std::string m_build_flags;
+};
+
+/* calls round until min_sample_ns is reached for each of the sample_count
+ * samples. round runs the kernel on a set of pairs and returns the number of
+ * pairs. Returns the time per pair of each sample
+ */
+template <typename Round>
+std::vector<double> sample(Round round)
+{
+    std::vector<double> samples;
+    for (std::size_t i = 0; i < sample_count; ++i) {
+        std::size_t calls = 0;
+        double elapsed = 0;
+        auto start = std::chrono::steady_clock::now();
+        do {
+            calls += round();
+            elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < min_sample_ns);
+        samples.push_back(elapsed / static_cast<double>(calls));
+    }
+    return samples;
+}
+
+template <typename Func>
+std::vector<double> measure(const std::vector<Sample>& samples, Func func)
+{
+    std::vector<proc_string> s1;
+    std::vector<proc_string> s2;
+    for (const auto& sample : samples) {
+        s1.push_back(sample.s1());
+        s2.push_back(sample.s2());
+    }
+
+    return sample([&]() {
+        double result = 0;
+        for (std::size_t i = 0; i < s1.size(); ++i) {
+            result += func(s1[i], s2[i]);
+        }
+        sink = result;
+        return s1.size();
+    });
+}
+
+/* only the scorers supporting batches provide ratio_batch */
+template <typename Context>
+std::size_t batch_size(const Context& context)
+{
+    return context.batch_size;
+}
+
+template <typename Context, typename Cutoff>
+void ratio_batch(Context& context, const proc_string* strs, std::size_t count, Cutoff score_cutoff, Cutoff* results)
+{
+    context.ratio_batch(strs, count, score_cutoff, results);
+}
+
+/* the cached scorers are created for s1 before the measurement, so only
+ * the comparisons with s2 are measured
+ */
+template <typename Context, typename Init, typename Cutoff>
+std::vector<double> measure_cached(const std::vector<Sample>& samples, Init init, Cutoff score_cutoff, bool batch)
+{
+    std::vector<proc_string> s2;
+    std::vector<Context> contexts;
+    for (const auto& sample : samples) {
+        contexts.push_back(init(sample.s1()));
+        s2.push_back(sample.s2());
+    }
+
+    if (batch && batch_size(contexts[0]) <= 1) {
+        return {};
+    }
+
+    std::vector<Cutoff> results(s2.size());
+    return sample([&]() {
+        double result = 0;
+        if (batch) {
+            /* all choices are compared with the query of the first pair */
+            ratio_batch(contexts[0], s2.data(), s2.size(), score_cutoff, results.data());
+            for (const auto& r : results) {
+                result += static_cast<double>(r);
+            }
+        } else {
+            for (std::size_t i = 0; i < s2.size(); ++i) {
+                result += static_cast<double>(contexts[i].ratio(s2[i], score_cutoff));
+            }
+        }
+        sink = result;
+        return s2.size();
+    });
+}
+
+double py_distance(PyObject* result)
+{
+    double dist = PyLong_AsDouble(result);
+    Py_DECREF(result);
+    return dist;
+}
+
+typedef double (*kernel_func)(const proc_string& s1, const proc_string& s2);
+
+struct Kernel {
+    const char* name;
+    kernel_func func;
+};
+
+#define RATIO_KERNEL(RATIO) \
+    {#RATIO, [](const proc_string& s1, const proc_string& s2) { return RATIO##_no_process(s1, s2, 0); }}
+
+#define DISTANCE_KERNEL(DISTANCE) \
+    {#DISTANCE, [](const proc_string& s1, const proc_string& s2) { return py_distance(DISTANCE##_no_process(s1, s2, (size_t)-1)); }}
+
+const Kernel kernels[] = {
+    RATIO_KERNEL(ratio),
+    RATIO_KERNEL(partial_ratio),
+    RATIO_KERNEL(token_sort_ratio),
+    RATIO_KERNEL(token_set_ratio),
+    RATIO_KERNEL(token_ratio),
+    RATIO_KERNEL(partial_token_sort_ratio),
+    RATIO_KERNEL(partial_token_set_ratio),
+    RATIO_KERNEL(partial_token_ratio),
+    RATIO_KERNEL(WRatio),
+    RATIO_KERNEL(QRatio),
+    DISTANCE_KERNEL(hamming),
+    RATIO_KERNEL(normalized_hamming),
+    RATIO_KERNEL(jaro_similarity),
+    DISTANCE_KERNEL(osa),
+    RATIO_KERNEL(normalized_osa),
+    DISTANCE_KERNEL(damerau_levenshtein),
+    RATIO_KERNEL(normalized_damerau_levenshtein),
+    DISTANCE_KERNEL(indel),
+    RATIO_KERNEL(normalized_indel),
+    {"lcs_seq", [](const proc_string& s1, const proc_string& s2) {
+        return static_cast<double>(lcs_seq_no_process(s1, s2, 0));
+    }},
+    {"levenshtein", [](const proc_string& s1, const proc_string& s2) {
+        return py_distance(levenshtein_no_process(s1, s2, 1, 1, 1, (size_t)-1));
+    }},
+    {"levenshtein_parallel", [](const proc_string& s1, const proc_string& s2) {
+        return static_cast<double>(levenshtein_parallel_no_process(s1, s2, (size_t)-1, 1));
+    }},
+    {"normalized_levenshtein", [](const proc_string& s1, const proc_string& s2) {
+        return normalized_levenshtein_no_process(s1, s2, 1, 1, 1, 0);
+    }},
+    {"jaro_winkler_similarity", [](const proc_string& s1, const proc_string& s2) {
+        return jaro_winkler_similarity_no_process(s1, s2, 0.1, 0);
+    }},
+    {"levenshtein_editops", [](const proc_string& s1, const proc_string& s2) {
+        return static_cast<double>(levenshtein_editops_no_process(s1, s2).size());
+    }},
+    {"levenshtein_find_all", [](const proc_string& s1, const proc_string& s2) {
+        return static_cast<double>(levenshtein_find_all_no_process(s1, s2, s1.length / 4).size());
+    }},
+    {"partial_ratio_alignment", [](const proc_string& s1, const proc_string& s2) {
+        return partial_ratio_alignment_no_process(s1, s2, 0).score;
+    }},
+};
+
+typedef CachedScorerContext (*scorer_init_func)(const proc_string& str);
+typedef CachedDistanceContext (*distance_init_func)(const proc_string& str);
+
+struct CachedKernel {
+    const char* name;
+    scorer_init_func scorer_init;
+    distance_init_func distance_init;
+};
+
+#define CACHED_SCORER(RATIO) \
+    {"cached_" #RATIO, [](const proc_string& s) { return cached_##RATIO##_init(s, 0); }, nullptr}
+
+#define CACHED_DISTANCE(DISTANCE) \
+    {"cached_" #DISTANCE, nullptr, [](const proc_string& s) { return cached_##DISTANCE##_init(s, 0); }}
+
+const CachedKernel cached_kernels[] = {
+    CACHED_SCORER(ratio),
+    CACHED_SCORER(partial_ratio),
+    CACHED_SCORER(token_sort_ratio),
+    CACHED_SCORER(token_set_ratio),
+    CACHED_SCORER(token_ratio),
+    CACHED_SCORER(partial_token_sort_ratio),
+    CACHED_SCORER(partial_token_set_ratio),
+    CACHED_SCORER(partial_token_ratio),
+    CACHED_SCORER(WRatio),
+    CACHED_SCORER(QRatio),
+    {"cached_normalized_levenshtein", [](const proc_string& s) {
+        return cached_normalized_levenshtein_init(s, 0, 1, 1, 1);
+    }, nullptr},
+    CACHED_SCORER(normalized_hamming),
+    {"cached_jaro_winkler_similarity", [](const proc_string& s) {
+        return cached_jaro_winkler_similarity_init(s, 0, 0.1);
+    }, nullptr},
+    CACHED_SCORER(jaro_similarity),
+    CACHED_SCORER(normalized_osa),
+    CACHED_SCORER(normalized_damerau_levenshtein),
+    CACHED_SCORER(normalized_indel),
+    {"cached_levenshtein", nullptr, [](const proc_string& s) {
+        return cached_levenshtein_init(s, 0, 1, 1, 1);
+    }},
+    CACHED_DISTANCE(hamming),
+    CACHED_DISTANCE(osa),
+    CACHED_DISTANCE(damerau_levenshtein),
+    CACHED_DISTANCE(indel),
+    /* lcs_seq is a distance context returning an inverted similarity */
+    CACHED_DISTANCE(lcs_seq),
+};
+
+/* the kernels scoring several choices at once are compared with the same
+ * kernel using scalar lanes and with scoring the choices one by one. All of
+ * them compare every choice with the query of the first pair, since a batch
+ * is always scored against a single query
+ */
+template <typename CharT>
+rapidfuzz::basic_string_view<CharT> view(const std::vector<CharT>& str)
+{
+    return rapidfuzz::basic_string_view<CharT>(str.data(), str.size());
+}
+
+template <typename Match, typename CharT>
+std::vector<double> jaro_winkler_lanes(const std::vector<Sample>& samples, std::vector<CharT> Sample::*s1,
+                                       std::vector<CharT> Sample::*s2)
+{
+    typedef detail::CachedJaroWinklerSimilarity<rapidfuzz::basic_string_view<CharT>> Scorer;
+    Scorer scorer(view(samples[0].*s1));
+    if (!scorer.batch_supported() || (samples[0].*s2).size() > 64) {
+        return {};
+    }
+
+    typename Scorer::Batch batch;
+    std::vector<double> scores(samples.size());
+    return sample([&]() {
+        for (std::size_t i = 0; i < samples.size(); i += Scorer::batch_size) {
+            std::size_t count = std::min(Scorer::batch_size, samples.size() - i);
+            batch.clear();
+            for (std::size_t j = 0; j < count; ++j) {
+                scorer.batch_insert(batch, view(samples[i + j].*s2));
+            }
+            detail::jaro_winkler_batch<Match>(batch, scorer.scorer.s1.size(), scorer.prefix_weight, 0.0,
+                                              scores.data() + i);
+        }
+        sink = scores[0];
+        return samples.size();
+    });
+}
+
+template <typename CharT>
+std::vector<double> jaro_winkler_single(const std::vector<Sample>& samples, std::vector<CharT> Sample::*s1,
+                                        std::vector<CharT> Sample::*s2)
+{
+    detail::CachedJaroWinklerSimilarity<rapidfuzz::basic_string_view<CharT>> scorer(view(samples[0].*s1));
+    if (!scorer.batch_supported() || (samples[0].*s2).size() > 64) {
+        return {};
+    }
+
+    return sample([&]() {
+        double result = 0;
+        for (const auto& sample : samples) {
+            result += scorer.ratio(view(sample.*s2));
+        }
+        sink = result;
+        return samples.size();
+    });
+}
+
+template <typename Match, typename CharT>
+std::vector<double> hamming_lanes(const std::vector<Sample>& samples, std::vector<CharT> Sample::*s1,
+                                  std::vector<CharT> Sample::*s2)
+{
+    typedef detail::CachedHamming<rapidfuzz::basic_string_view<CharT>> Scorer;
+    Scorer scorer(view(samples[0].*s1));
+    if (!scorer.batch_supported()) {
+        return {};
+    }
+
+    typename Scorer::Batch batch;
+    std::vector<std::size_t> distances(samples.size());
+    return sample([&]() {
+        for (std::size_t i = 0; i < samples.size(); i += Scorer::batch_size) {
+            std::size_t count = std::min(Scorer::batch_size, samples.size() - i);
+            batch.clear();
+            for (std::size_t j = 0; j < count; ++j) {
+                scorer.batch_insert(batch, view(samples[i + j].*s2));
+            }
+            detail::hamming_corpus<Match>(scorer.repeated.data(), batch.codes.data(), scorer.s1.size(), batch.count,
+                                          (size_t)-1, distances.data() + i);
+        }
+        sink = static_cast<double>(distances[0]);
+        return samples.size();
+    });
+}
+
+template <typename CharT>
+std::vector<double> hamming_single(const std::vector<Sample>& samples, std::vector<CharT> Sample::*s1,
+                                   std::vector<CharT> Sample::*s2)
+{
+    detail::CachedHamming<rapidfuzz::basic_string_view<CharT>> scorer(view(samples[0].*s1));
+    if (!scorer.batch_supported()) {
+        return {};
+    }
+
+    return sample([&]() {
+        std::size_t result = 0;
+        for (const auto& sample : samples) {
+            result += scorer.distance(view(sample.*s2));
+        }
+        sink = static_cast<double>(result);
+        return samples.size();
+    });
+}
+
+typedef std::vector<double> (*lane_kernel_func)(const std::vector<Sample>& samples);
+
+struct LaneKernel {
+    const char* name;
+    lane_kernel_func func;
+};
+
+#define LANE_KERNEL(NAME, ...)                                                                 \
+    {NAME, [](const std::vector<Sample>& samples) {                                            \
+         return samples[0].wide ? __VA_ARGS__(samples, &Sample::data1, &Sample::data2)          \
+                                : __VA_ARGS__(samples, &Sample::bytes1, &Sample::bytes2);       \
+     }}
+
+const LaneKernel lane_kernels[] = {
+    LANE_KERNEL("jaro_winkler_lanes_simd", jaro_winkler_lanes<detail::JaroMatchSIMD>),
+    LANE_KERNEL("jaro_winkler_lanes_scalar", jaro_winkler_lanes<detail::JaroMatchScalar>),
+    LANE_KERNEL("jaro_winkler_lanes_single", jaro_winkler_single),
+    LANE_KERNEL("hamming_lanes_simd", hamming_lanes<detail::HammingMismatchSIMD>),
+    LANE_KERNEL("hamming_lanes_scalar", hamming_lanes<detail::HammingMismatchScalar>),
+    LANE_KERNEL("hamming_lanes_single", hamming_single),
+};
+
+std::vector<Config> configs()
+{
+    const std::size_t lengths[] = {8, 16, 32, 64, 128, 256, 1024};
+    const std::size_t alphabets[] = {4, 26, 256, 4096};
+    const double similarities[] = {0.0, 0.5, 0.9};
+
+    std::vector<Config> result;
+    for (std::size_t length : lengths) {
+        for (std::size_t alphabet : alphabets) {
+            for (double similarity : similarities) {
+                result.push_back({length, alphabet, similarity});
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    const char* filter = "";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else {
+            filter = argv[i];
+        }
+    }
+    auto matches = [&](const char* name) { return std::strstr(name, filter) != nullptr; };
+
+    /* the distances are returned as Python integers */
+    Py_Initialize();
+    Reporter reporter(json);
+
+    for (const Config& config : configs()) {
+        std::mt19937_64 gen(42);
+        std::vector<Sample> samples = generate(config, gen);
+
+        for (const Kernel& kernel : kernels) {
+            if (matches(kernel.name)) {
+                reporter.report(kernel.name, config, measure(samples, kernel.func));
+            }
+        }
+
+        for (const LaneKernel& kernel : lane_kernels) {
+            if (matches(kernel.name)) {
+                /* only choices with up to 64 characters are scored in lanes */
+                std::vector<double> ns_per_pair = kernel.func(samples);
+                if (!ns_per_pair.empty()) {
+                    reporter.report(kernel.name, config, ns_per_pair);
+                }
+            }
+        }
+
+        for (const CachedKernel& kernel : cached_kernels) {
+            if (!matches(kernel.name)) {
+                continue;
+            }
+
+            for (bool batch : {false, true}) {
+                std::vector<double> ns_per_pair;
+                if (kernel.scorer_init) {
+                    ns_per_pair = measure_cached<CachedScorerContext>(samples, kernel.scorer_init, 0.0, batch);
+                } else {
+                    ns_per_pair = measure_cached<CachedDistanceContext>(samples, kernel.distance_init, (size_t)-1, batch);
+                }
+
+                /* only scorers supporting batches are reported for the batch mode */
+                if (!ns_per_pair.empty()) {
+                    reporter.report(std::string(kernel.name) + (batch ? "_batch" : ""), config, ns_per_pair);
+                }
+            }
+        }
+    }
+
+    Py_Finalize();
+    return 0;
+}
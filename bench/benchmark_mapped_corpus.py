@@ -0,0 +1,107 @@
+"""
+compares the startup time and the searches of process.MappedCorpus with a
+list of choices loaded from a text file, which is the startup of a worker
+process without the corpus file. For every corpus size the following is
+recorded:
+
+- load: reading the list of choices from a text file with one choice per line
+- open: opening the corpus file written by MappedCorpus.write
+- extractOne: process.extractOne on the list and MappedCorpus.extractOne
+  with fuzz.WRatio and with fuzz.ratio with a score_cutoff of 80, which can
+  use the length index of the corpus file
+
+usage:
+  python benchmark_mapped_corpus.py --kind names --sizes 10000 100000 1000000
+
+The results are written to results/mapped_corpus.csv and in the format of
+benchmark_results.py to results/mapped_corpus.json
+"""
+import argparse
+import os
+import tempfile
+import time
+
+import pandas
+from rapidfuzz import fuzz, process
+
+from benchmark_results import BenchmarkResults
+from workloads import CORPORA, add_error_model_arguments, error_model_from_arguments, make_workload
+
+SCORERS = [
+    ("WRatio", fuzz.WRatio, None),
+    ("ratio", fuzz.ratio, 80),
+]
+
+
+def measure(func, repeat):
+    """runs func repeat times and returns the time of each run in ns"""
+    samples = []
+    for _ in range(repeat):
+        start = time.perf_counter_ns()
+        func()
+        samples.append(time.perf_counter_ns() - start)
+    return samples
+
+
+def load_lines(path):
+    with open(path, encoding="utf8") as f:
+        return f.read().split("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="benchmark process.MappedCorpus")
+    parser.add_argument("--kind", choices=sorted(CORPORA), default="names")
+    parser.add_argument("--sizes", nargs="+", type=int, default=[10000, 100000, 1000000])
+    parser.add_argument("--queries", type=int, default=10, help="queries per configuration (default: 10)")
+    parser.add_argument("--repeat", type=int, default=7, help="repetitions of load and open (default: 7)")
+    parser.add_argument("--seed", type=int, default=18)
+    parser.add_argument("--output", default="results/mapped_corpus", help="path of the results without extension")
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    error_model = error_model_from_arguments(args)
+    report = BenchmarkResults("mapped_corpus")
+    rows = []
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for size in args.sizes:
+            choices, queries, _ = make_workload(args.kind, size, args.queries, error_model, args.seed)
+            # the choices can not contain newlines, since they are generated from the corpora
+            text_path = os.path.join(tmp, "choices.txt")
+            corpus_path = os.path.join(tmp, "choices.rfc")
+            with open(text_path, "w", encoding="utf8") as f:
+                f.write("\n".join(choices))
+            process.MappedCorpus.write(corpus_path, choices)
+
+            params = {"workload": args.kind, "corpus_size": size}
+            load = measure(lambda: load_lines(text_path), args.repeat)
+            report.add("load list", params, load)
+            open_ = measure(lambda: process.MappedCorpus(corpus_path).close(), args.repeat)
+            report.add("MappedCorpus open", params, open_)
+            row = dict(params, load_ms=min(load) / 1e6, open_ms=min(open_) / 1e6,
+                       file_bytes=os.path.getsize(corpus_path))
+
+            with process.MappedCorpus(corpus_path) as corpus:
+                for scorer_name, scorer, score_cutoff in SCORERS:
+                    list_samples = [measure(lambda: process.extractOne(
+                        query, choices, scorer=scorer, score_cutoff=score_cutoff), 1)[0] for query in queries]
+                    mapped_samples = [measure(lambda: corpus.extractOne(
+                        query, scorer=scorer, score_cutoff=score_cutoff), 1)[0] for query in queries]
+
+                    scorer_params = dict(params, scorer=scorer_name, score_cutoff=score_cutoff or 0)
+                    report.add("extractOne (list)", scorer_params, list_samples)
+                    report.add("extractOne (MappedCorpus)", scorer_params, mapped_samples)
+                    row[f"{scorer_name}_list_ms"] = sorted(list_samples)[len(list_samples) // 2] / 1e6
+                    row[f"{scorer_name}_mapped_ms"] = sorted(mapped_samples)[len(mapped_samples) // 2] / 1e6
+
+            rows.append(row)
+            print(", ".join(f"{key}={value:.3f}" if isinstance(value, float) else f"{key}={value}"
+                            for key, value in row.items()))
+
+    df = pandas.DataFrame(rows)
+    df.to_csv(args.output + ".csv", sep=',', index=False)
+    report.write(args.output + ".json")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,181 @@
+"""
+measures the memory used by the process functions. The interpreter is run with
+alloc_counter.so preloaded (see alloc_counter.cpp), which counts every call of
+malloc, so allocations of the extension, like the result slots reserved by
+extract or the strings created by default_process, are visible. For every
+call the following is recorded:
+
+- allocations: number of allocations
+- allocated_bytes: sum of the sizes of all allocations
+- peak_bytes: highest number of live bytes during the call above the live
+  bytes before the call
+- peak_rss_bytes: growth of the peak resident set size during the call. The
+  peak is reset through /proc/self/clear_refs, so this is only available on Linux
+
+build the allocator and run from the bench directory:
+  g++ -O2 -std=c++11 -shared -fPIC alloc_counter.cpp -o alloc_counter.so
+  python benchmark_memory.py --sizes 1000 10000
+
+The results are written to results/memory.csv and in the format of
+benchmark_results.py to results/memory.json, so memory regressions can be
+found with compare_results.py like speed regressions.
+"""
+import argparse
+import collections
+import ctypes
+import gc
+import os
+import sys
+
+import pandas
+from rapidfuzz import fuzz, process, string_metric, utils
+
+from benchmark_results import BenchmarkResults
+from workloads import CORPORA, add_error_model_arguments, error_model_from_arguments, make_workload
+
+ALLOCATOR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "alloc_counter.so")
+
+SCORERS = {
+    "ratio": fuzz.ratio,
+    "WRatio": fuzz.WRatio,
+    "token_set_ratio": fuzz.token_set_ratio,
+    "levenshtein": string_metric.levenshtein,
+    "normalized_levenshtein": string_metric.normalized_levenshtein,
+}
+
+PROCESSORS = {
+    "default_process": utils.default_process,
+    "none": None,
+}
+
+METRICS = [
+    ("allocations", "allocations"),
+    ("allocated_bytes", "B"),
+    ("peak_bytes", "B"),
+    ("peak_rss_bytes", "B"),
+]
+
+
+def load_counter():
+    """returns the counters of the preloaded allocator or None when it is not loaded"""
+    try:
+        lib = ctypes.CDLL(None)
+        read = lib.alloc_counter_read
+        reset_peak = lib.alloc_counter_reset_peak
+    except AttributeError:
+        return None
+
+    def counters():
+        values = (ctypes.c_uint64 * 4)()
+        read(values)
+        return list(values)
+    return counters, reset_peak
+
+
+def read_status(field):
+    """size of a field of /proc/self/status in bytes"""
+    with open("/proc/self/status") as f:
+        for line in f:
+            if line.startswith(field + ":"):
+                return int(line.split()[1]) * 1024
+    return 0
+
+
+def reset_peak_rss():
+    try:
+        with open("/proc/self/clear_refs", "w") as f:
+            f.write("5")
+        return True
+    except OSError:
+        return False
+
+
+def measure(call, counters, reset_peak):
+    gc.collect()
+    rss_supported = reset_peak_rss()
+    rss_before = read_status("VmRSS") if rss_supported else 0
+    reset_peak()
+    before = counters()
+
+    result = call()
+
+    after = counters()
+    peak_rss = read_status("VmHWM") - rss_before if rss_supported else 0
+    del result
+    return {
+        "allocations": after[0] - before[0],
+        "allocated_bytes": after[1] - before[1],
+        "peak_bytes": max(0, after[3] - before[2]),
+        "peak_rss_bytes": max(0, peak_rss),
+    }
+
+
+def make_call(func, query, choices, scorer, processor, limit):
+    if func == "extractOne":
+        return lambda: process.extractOne(query, choices, scorer=scorer, processor=processor)
+    if func == "extract":
+        return lambda: process.extract(query, choices, scorer=scorer, processor=processor, limit=limit)
+    # consume the generator without keeping the results
+    return lambda: collections.deque(process.extract_iter(query, choices, scorer=scorer, processor=processor), maxlen=0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="benchmark the memory usage of process")
+    parser.add_argument("--kind", choices=sorted(CORPORA), default="names")
+    parser.add_argument("--sizes", nargs="+", type=int, default=[1000, 10000, 100000])
+    parser.add_argument("--scorers", nargs="+", choices=list(SCORERS), default=list(SCORERS))
+    parser.add_argument("--processors", nargs="+", choices=list(PROCESSORS), default=list(PROCESSORS))
+    parser.add_argument("--calls", type=int, default=5, help="measured calls per configuration (default: 5)")
+    parser.add_argument("--seed", type=int, default=18)
+    parser.add_argument("--output", default="results/memory", help="path of the results without extension")
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    counter = load_counter()
+    if counter is None:
+        if not os.path.exists(ALLOCATOR):
+            sys.exit(f"{ALLOCATOR} not found, build it with:\n"
+                     "  g++ -O2 -std=c++11 -shared -fPIC alloc_counter.cpp -o alloc_counter.so")
+        if ALLOCATOR in os.environ.get("LD_PRELOAD", ""):
+            sys.exit(f"{ALLOCATOR} is preloaded, but its counters were not found")
+        os.environ["LD_PRELOAD"] = ":".join(filter(None, [ALLOCATOR, os.environ.get("LD_PRELOAD")]))
+        os.execv(sys.executable, [sys.executable] + sys.argv)
+    counters, reset_peak = counter
+
+    error_model = error_model_from_arguments(args)
+    report = BenchmarkResults("memory")
+    rows = []
+
+    for size in args.sizes:
+        choices, queries, _ = make_workload(args.kind, size, args.calls, error_model, args.seed)
+        for func, limit in [("extractOne", None), ("extract", 5), ("extract", None), ("extract_iter", None)]:
+            for scorer_name in args.scorers:
+                for processor_name in args.processors:
+                    calls = [make_call(func, query, choices, SCORERS[scorer_name], PROCESSORS[processor_name], limit)
+                             for query in queries]
+                    calls[0]()
+                    samples = [measure(call, counters, reset_peak) for call in calls]
+
+                    params = {"workload": args.kind, "corpus_size": size, "scorer": scorer_name,
+                              "processor": processor_name}
+                    if func == "extract":
+                        params["limit"] = "all" if limit is None else limit
+
+                    row = dict(function=func, **params)
+                    for metric, unit in METRICS:
+                        values = [sample[metric] for sample in samples]
+                        report.add(f"process.{func}", dict(params, metric=metric), values, unit=unit)
+                        row[metric] = sorted(values)[len(values) // 2]
+                    rows.append(row)
+                    print(f"{func} size={size} scorer={scorer_name} processor={processor_name} "
+                          f"limit={params.get('limit', '-')}: {row['allocations']} allocations, "
+                          f"{row['allocated_bytes']} B allocated, peak {row['peak_bytes']} B, "
+                          f"peak rss {row['peak_rss_bytes']} B")
+
+    df = pandas.DataFrame(rows)
+    df.to_csv(args.output + ".csv", sep=',', index=False)
+    report.write(args.output + ".json")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+"""
+benchmarks process.extract, process.extractOne and process.extract_iter on the
+workloads generated by workloads.py. Sweeps the corpus size, score_cutoff,
+limit and the number of threads issuing queries concurrently. For every
+configuration the throughput in queries per second, the latency percentiles of
+the single queries and the share of queries which found the entry they were
+derived from are reported.
+
+usage:
+  python benchmark_process.py --kinds names titles --sizes 1000 10000 --threads 1 4
+
+The results are written to results/process.csv and in the format of
+benchmark_results.py to results/process.json
+"""
+import argparse
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import pandas
+from rapidfuzz import fuzz, process
+
+from benchmark_results import BenchmarkResults, percentile
+from workloads import CORPORA, add_error_model_arguments, error_model_from_arguments, make_workload
+
+
+def parse_limit(value):
+    return None if value == "all" else int(value)
+
+
+def found(func, result, target):
+    """checks whether the entry the query was derived from is part of the result"""
+    if func == "extractOne":
+        return result is not None and result[0] == target
+    return any(choice == target for choice, _, _ in result)
+
+
+def run(func, query_func, choices, queries, threads, kwargs):
+    """
+    runs all queries using `threads` threads and returns the results, the
+    latency of each query in ns and the elapsed time in ns
+    """
+    latencies = [0] * len(queries)
+
+    def query(i):
+        start = time.perf_counter_ns()
+        result = query_func(queries[i], choices, **kwargs)
+        if func == "extract_iter":
+            result = list(result)
+        latencies[i] = time.perf_counter_ns() - start
+        return result
+
+    # warm up the caches and the thread pool
+    query(0)
+
+    with ThreadPoolExecutor(threads) as pool:
+        start = time.perf_counter_ns()
+        results = list(pool.map(query, range(len(queries))))
+        elapsed = time.perf_counter_ns() - start
+    return results, latencies, elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="benchmark process on generated workloads")
+    parser.add_argument("--kinds", nargs="+", choices=sorted(CORPORA), default=list(CORPORA))
+    parser.add_argument("--sizes", nargs="+", type=int, default=[1000, 10000, 100000])
+    parser.add_argument("--cutoffs", nargs="+", type=float, default=[0, 80])
+    parser.add_argument("--limits", nargs="+", type=parse_limit, default=[5, None],
+        help="limits used for extract, 'all' for no limit (default: 5 all)")
+    parser.add_argument("--threads", nargs="+", type=int, default=[1, 2, 4])
+    parser.add_argument("--functions", nargs="+", choices=["extract", "extractOne", "extract_iter"],
+        default=["extract", "extractOne", "extract_iter"])
+    parser.add_argument("--scorer", default="WRatio", help="scorer from rapidfuzz.fuzz (default: WRatio)")
+    parser.add_argument("--queries", type=int, default=100, help="queries per configuration (default: 100)")
+    parser.add_argument("--seed", type=int, default=18)
+    parser.add_argument("--output", default="results/process", help="path of the results without extension")
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    scorer = getattr(fuzz, args.scorer)
+    error_model = error_model_from_arguments(args)
+    report = BenchmarkResults("process")
+    rows = []
+
+    for kind in args.kinds:
+        for size in args.sizes:
+            choices, queries, targets = make_workload(kind, size, args.queries, error_model, args.seed)
+            targets = [choices[i] for i in targets]
+
+            for func in args.functions:
+                limits = args.limits if func == "extract" else [None]
+                for score_cutoff in args.cutoffs:
+                    for limit in limits:
+                        kwargs = {"scorer": scorer, "score_cutoff": score_cutoff}
+                        if func == "extract":
+                            kwargs["limit"] = limit
+
+                        for threads in args.threads:
+                            results, latencies, elapsed = run(func, getattr(process, func),
+                                choices, queries, threads, kwargs)
+
+                            params = {"workload": kind, "corpus_size": size, "score_cutoff": score_cutoff,
+                                      "threads": threads, "scorer": args.scorer}
+                            if func == "extract":
+                                params["limit"] = "all" if limit is None else limit
+                            report.add(f"process.{func}", params, latencies)
+
+                            latencies.sort()
+                            row = dict(function=func, **params,
+                                queries_per_s=len(queries) / elapsed * 1e9,
+                                p50_ms=percentile(latencies, 0.5) / 1e6,
+                                p90_ms=percentile(latencies, 0.9) / 1e6,
+                                p99_ms=percentile(latencies, 0.99) / 1e6,
+                                found=sum(found(func, r, t) for r, t in zip(results, targets)) / len(queries))
+                            rows.append(row)
+                            print(f"{func} {kind} size={size} score_cutoff={score_cutoff} limit={params.get('limit', '-')} "
+                                  f"threads={threads}: {row['queries_per_s']:.1f} queries/s, "
+                                  f"p50={row['p50_ms']:.3f}ms p90={row['p90_ms']:.3f}ms p99={row['p99_ms']:.3f}ms, "
+                                  f"found={row['found']:.2f}")
+
+    df = pandas.DataFrame(rows)
+    df.to_csv(args.output + ".csv", sep=',', index=False)
+    report.write(args.output + ".json")
+
+
+if __name__ == "__main__":
+    main()
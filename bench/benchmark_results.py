@@ -0,0 +1,174 @@
+"""
+stores benchmark results in a stable format, so the results of two builds
+can be compared with compare_results.py. Every result is identified by the
+name of the kernel and its parameters and keeps all timing samples, so the
+comparison can test whether a difference is significant.
+
+The results are written as json:
+
+    {
+      "schema": 1,
+      "suite": "fuzz",
+      "cpu_model": "...",
+      "build_flags": "...",
+      "results": [
+        {"kernel": "ratio (rapidfuzz)", "params": {"length": 8},
+         "median_ns": ..., "p10_ns": ..., "p90_ns": ..., "samples_ns": [...]}
+      ]
+    }
+
+or as csv with the columns in CSV_COLUMNS. The params are stored as
+"key=value" pairs separated by ";" and the samples separated by spaces.
+bench/benchmark_kernels.cpp writes the same format.
+
+Results, which are not timings, like the allocations recorded by
+benchmark_memory.py, store their unit in "unit". The fields keep their names,
+so results without a unit are in ns.
+"""
+import csv
+import json
+import os
+import platform
+import sysconfig
+import timeit
+
+SCHEMA_VERSION = 1
+
+CSV_COLUMNS = ["suite", "kernel", "params", "median_ns", "p10_ns", "p90_ns",
+               "samples_ns", "cpu_model", "build_flags", "unit"]
+
+
+def cpu_model():
+    try:
+        with open("/proc/cpuinfo") as f:
+            for line in f:
+                if line.startswith("model name"):
+                    return line.split(":", 1)[1].strip()
+    except OSError:
+        pass
+    return platform.processor() or platform.machine() or "unknown"
+
+
+def build_flags():
+    """
+    the extension is built by setup.py with the flags of the Python
+    interpreter and the flags from the CFLAGS environment variable
+    """
+    import rapidfuzz
+    flags = [f"rapidfuzz={rapidfuzz.__version__}",
+             f"python={platform.python_version()}",
+             f"cc={sysconfig.get_config_var('CC') or ''}"]
+    if os.environ.get("CFLAGS"):
+        flags.append(f"cflags={os.environ['CFLAGS']}")
+    return " ".join(flags)
+
+
+def percentile(sorted_values, q):
+    """percentile with linear interpolation between the closest ranks"""
+    pos = (len(sorted_values) - 1) * q
+    lower = int(pos)
+    upper = min(lower + 1, len(sorted_values) - 1)
+    return sorted_values[lower] + (sorted_values[upper] - sorted_values[lower]) * (pos - lower)
+
+
+def params_key(params):
+    return ";".join(f"{key}={params[key]}" for key in sorted(params))
+
+
+def _parse_value(value):
+    for convert in (int, float):
+        try:
+            return convert(value)
+        except ValueError:
+            pass
+    return value
+
+
+def _parse_params(text):
+    if not text:
+        return {}
+    return {key: _parse_value(value) for key, value in
+        (item.split("=", 1) for item in text.split(";"))}
+
+
+class BenchmarkResults:
+    def __init__(self, suite):
+        self.suite = suite
+        self.cpu_model = cpu_model()
+        self.build_flags = build_flags()
+        self.results = []
+
+    def add(self, kernel, params, samples_ns, unit="ns"):
+        samples = sorted(samples_ns)
+        self.results.append({
+            "kernel": kernel,
+            "params": dict(params),
+            "unit": unit,
+            "median_ns": percentile(samples, 0.5),
+            "p10_ns": percentile(samples, 0.1),
+            "p90_ns": percentile(samples, 0.9),
+            "samples_ns": list(samples_ns)
+        })
+
+    def timeit(self, kernel, params, stmt, setup, count, repeat=7):
+        """
+        runs stmt repeat times, records the time of each run divided by count
+        and returns the fastest of them
+        """
+        test = timeit.Timer(stmt, setup=setup)
+        samples = [test.timeit(number=1) / count for _ in range(repeat)]
+        self.add(kernel, params, [sample * 1e9 for sample in samples])
+        return min(samples)
+
+    def write(self, path):
+        """writes the results as csv when path ends with .csv and as json otherwise"""
+        if path.endswith(".csv"):
+            with open(path, "w", newline="") as f:
+                writer = csv.writer(f)
+                writer.writerow(CSV_COLUMNS)
+                for result in self.results:
+                    writer.writerow([
+                        self.suite, result["kernel"], params_key(result["params"]),
+                        result["median_ns"], result["p10_ns"], result["p90_ns"],
+                        " ".join(str(sample) for sample in result["samples_ns"]),
+                        self.cpu_model, self.build_flags, result["unit"]
+                    ])
+        else:
+            with open(path, "w") as f:
+                json.dump({
+                    "schema": SCHEMA_VERSION,
+                    "suite": self.suite,
+                    "cpu_model": self.cpu_model,
+                    "build_flags": self.build_flags,
+                    "results": self.results
+                }, f, indent=1)
+
+
+def load(path):
+    """
+    reads a result file written by BenchmarkResults.write or by
+    benchmark_kernels. Returns a dict with the same layout as the json files
+    """
+    if path.endswith(".csv"):
+        data = {"schema": SCHEMA_VERSION, "suite": "", "cpu_model": "", "build_flags": "", "results": []}
+        with open(path, newline="") as f:
+            for row in csv.DictReader(f):
+                data["suite"] = row["suite"]
+                data["cpu_model"] = row["cpu_model"]
+                data["build_flags"] = row["build_flags"]
+                data["results"].append({
+                    "kernel": row["kernel"],
+                    "params": _parse_params(row["params"]),
+                    "unit": row.get("unit") or "ns",
+                    "median_ns": float(row["median_ns"]),
+                    "p10_ns": float(row["p10_ns"]),
+                    "p90_ns": float(row["p90_ns"]),
+                    "samples_ns": [float(x) for x in row["samples_ns"].split()]
+                })
+        return data
+
+    with open(path) as f:
+        data = json.load(f)
+    if data.get("schema") != SCHEMA_VERSION:
+        raise ValueError(f"{path}: unsupported schema version {data.get('schema')}")
+    return data
@@ -0,0 +1,61 @@
+import timeit
+import pandas
+from benchmark_results import BenchmarkResults
+
+report = BenchmarkResults("token_set")
+
+def benchmark(name, func, setup, token_counts, overlap, count):
+    print(f"starting {name} (overlap {overlap})")
+    start = timeit.default_timer()
+    results = []
+    for token_count in token_counts:
+        results.append(report.timeit(name, {"token_count": token_count, "overlap": overlap},
+            func, setup.format(token_count, overlap, count), count))
+    stop = timeit.default_timer()
+    print(f"finished {name}, Runtime: ", stop - start)
+    return results
+
+# the query shares `overlap` of its tokens with every choice
+setup ="""
+from rapidfuzz import fuzz, process
+import string
+import random
+random.seed(18)
+vocabulary = [''.join(random.choice(string.ascii_lowercase) for _ in range(random.randint(2, 10))) for _ in range(5000)]
+def sentence(shared, length):
+    return ' '.join(random.sample(shared, len(shared)) + random.sample(vocabulary, length - len(shared)))
+a_tokens = random.sample(vocabulary, {0})
+shared = a_tokens[:int({0} * {1})]
+a = ' '.join(a_tokens)
+b_list = [sentence(shared, {0}) for _ in range({2})]
+corpus = process.TokenCorpus(b_list)
+"""
+
+token_counts = [1, 2, 4, 8, 16, 32, 64]
+overlaps = [0.0, 0.25, 0.5, 0.75, 1.0]
+count = 1000
+
+data = {"token_count": [], "overlap": []}
+for scorer in ["token_set_ratio", "partial_token_set_ratio"]:
+    for overlap in overlaps:
+        time_extract = benchmark(f"{scorer} (process.extract)",
+            f'process.extract(a, b_list, scorer=fuzz.{scorer}, limit=None)',
+            setup, token_counts, overlap, count)
+
+        # the tokens of the choices are interned, so the set operations
+        # are intersections of sorted integer arrays
+        time_corpus = benchmark(f"{scorer} (process.TokenCorpus)",
+            f'corpus.extract(a, scorer=fuzz.{scorer}, limit=None)',
+            setup, token_counts, overlap, count)
+
+        if scorer == "token_set_ratio":
+            data["token_count"] += token_counts
+            data["overlap"] += [overlap] * len(token_counts)
+        data.setdefault(f"{scorer} (process.extract)", []).extend(time_extract)
+        data.setdefault(f"{scorer} (process.TokenCorpus)", []).extend(time_corpus)
+
+df = pandas.DataFrame(data=data)
+
+df.to_csv("results/token_set.csv", sep=',',index=False)
+
+report.write("results/token_set.json")
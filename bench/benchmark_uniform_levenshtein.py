@@ -1,14 +1,17 @@
 import timeit
 import pandas
 import numpy as np
+from benchmark_results import BenchmarkResults
 
-def benchmark(name, func, setup, lengths, count):
+report = BenchmarkResults("levenshtein_uniform")
+
+def benchmark(name, func, setup, lengths, count, **params):
     print(f"starting {name}")
     start = timeit.default_timer()
     results = []
     for length in lengths:
-        test = timeit.Timer(func, setup=setup.format(length, count))
-        results.append(min(test.timeit(number=1) for _ in range(7)) / count)
+        results.append(report.timeit(name, dict(params, length=length),
+            func, setup.format(length, count), count))
     stop = timeit.default_timer()
     print(f"finished {name}, Runtime: ", stop - start)
     return results
@@ -61,3 +64,85 @@ df = pandas.DataFrame(data={
 })
 
 df.to_csv("results/levenshtein_uniform.csv", sep=',',index=False)
+
+# long strings, which only differ in a few places. b_list contains copies of a
+# with {2} random substitutions, insertions and deletions
+setup_similar ="""
+from rapidfuzz import string_metric
+import polyleven
+import edlib
+import string
+import random
+random.seed(18)
+characters = string.ascii_letters + string.digits + string.whitespace + string.punctuation
+a = ''.join(random.choice(characters) for _ in range({0}))
+
+def mutate(s, edits):
+    s = list(s)
+    for _ in range(edits):
+        pos = random.randrange(len(s))
+        op = random.randrange(3)
+        if op == 0:
+            s[pos] = random.choice(characters)
+        elif op == 1:
+            del s[pos]
+        else:
+            s.insert(pos, random.choice(characters))
+    return ''.join(s)
+
+b_list = [mutate(a, {2}) for _ in range({1})]
+"""
+
+similar_lengths = [int(x) for x in np.logspace(2, 6, num=17)]
+similar_count = 10
+edits = 10
+
+time_rapidfuzz = benchmark("rapidfuzz",
+        '[string_metric.levenshtein(a, b) for b in b_list]',
+        setup_similar.replace("{2}", str(edits)), similar_lengths, similar_count, edits=edits)
+
+time_rapidfuzz_max = benchmark("rapidfuzz (max=2*edits)",
+        '[string_metric.levenshtein(a, b, max={}) for b in b_list]'.format(2 * edits),
+        setup_similar.replace("{2}", str(edits)), similar_lengths, similar_count, edits=edits)
+
+time_polyleven = benchmark("polyleven",
+        '[polyleven.levenshtein(a, b) for b in b_list]',
+        setup_similar.replace("{2}", str(edits)), similar_lengths, similar_count, edits=edits)
+
+time_edlib = benchmark("edlib",
+        '[edlib.align(a, b) for b in b_list]',
+        setup_similar.replace("{2}", str(edits)), similar_lengths, similar_count, edits=edits)
+
+df = pandas.DataFrame(data={
+    "length": similar_lengths,
+    "rapidfuzz": time_rapidfuzz,
+    "rapidfuzz (max)": time_rapidfuzz_max,
+    "polyleven": time_polyleven,
+    "edlib": time_edlib
+})
+
+df.to_csv("results/levenshtein_uniform_similar.csv", sep=',',index=False)
+
+# a single comparision of two very long strings using multiple threads
+setup_workers ="""
+from rapidfuzz import string_metric
+import string
+import random
+random.seed(18)
+characters = string.ascii_letters + string.digits + string.whitespace + string.punctuation
+a = ''.join(random.choice(characters) for _ in range({0}))
+b = ''.join(random.choice(characters) for _ in range({0}))
+"""
+
+workers_lengths = [10000, 50000, 100000, 200000]
+results = {"length": workers_lengths}
+for workers in [1, 2, 4, 8]:
+    results["workers={}".format(workers)] = benchmark("rapidfuzz (workers={})".format(workers),
+        'string_metric.levenshtein(a, b, workers={})'.format(workers),
+        setup_workers, workers_lengths, 1)
+
+df = pandas.DataFrame(data=results)
+
+df.to_csv("results/levenshtein_uniform_workers.csv", sep=',',index=False)
+
+report.write("results/levenshtein_uniform.json")
@@ -0,0 +1,123 @@
+"""
+compares two result files written by the benchmarks (see benchmark_results.py)
+and reports the kernels which became significantly slower or, for results with
+another unit like the allocations of benchmark_memory.py, larger.
+
+usage:
+  python compare_results.py base.json new.json [--threshold 5] [--alpha 0.01]
+
+A kernel is reported as regression when its median is more than threshold
+percent above the median of the base and a one sided Mann-Whitney U test of
+the samples is significant at the level alpha. The test does not assume a
+distribution of the timings, which are usually skewed by outliers. The exit
+code is 1 when a regression was found, so the script can be used to gate builds.
+"""
+import argparse
+import math
+import sys
+
+from benchmark_results import load, params_key
+
+
+def mann_whitney_greater(base, new):
+    """
+    p-value of the hypothesis that the samples in new are larger than the
+    samples in base. Uses the normal approximation with tie correction,
+    which is accurate enough for the 7+ samples recorded per kernel
+    """
+    n1 = len(base)
+    n2 = len(new)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    values = sorted([(x, 0) for x in base] + [(x, 1) for x in new])
+    n = n1 + n2
+    ranks = [0.0] * n
+    tie_sum = 0
+    i = 0
+    while i < n:
+        j = i
+        while j + 1 < n and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        ties = j - i + 1
+        tie_sum += ties ** 3 - ties
+        i = j + 1
+
+    rank_sum_new = sum(rank for rank, (_, group) in zip(ranks, values) if group == 1)
+    u = rank_sum_new - n2 * (n2 + 1) / 2
+    mean = n1 * n2 / 2
+    var = n1 * n2 / 12 * ((n + 1) - tie_sum / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (u - mean - 0.5) / math.sqrt(var)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def compare(base, new, threshold, alpha):
+    base_results = {(r["kernel"], params_key(r["params"])): r for r in base["results"]}
+    new_results = {(r["kernel"], params_key(r["params"])): r for r in new["results"]}
+
+    rows = []
+    for key, new_result in new_results.items():
+        base_result = base_results.get(key)
+        if base_result is None:
+            continue
+        if new_result["median_ns"] == base_result["median_ns"]:
+            continue
+        if base_result["median_ns"]:
+            change = (new_result["median_ns"] / base_result["median_ns"] - 1) * 100
+        else:
+            change = math.inf
+        if abs(change) <= threshold:
+            continue
+        if change > 0:
+            p = mann_whitney_greater(base_result["samples_ns"], new_result["samples_ns"])
+        else:
+            p = mann_whitney_greater(new_result["samples_ns"], base_result["samples_ns"])
+        if p < alpha:
+            rows.append((key, base_result["median_ns"], new_result["median_ns"], change, p,
+                new_result.get("unit", "ns")))
+
+    missing = sorted(set(base_results) - set(new_results))
+    return rows, missing
+
+
+def main():
+    parser = argparse.ArgumentParser(description="compare two benchmark result files")
+    parser.add_argument("base", help="results of the reference build")
+    parser.add_argument("new", help="results of the build to check")
+    parser.add_argument("--threshold", type=float, default=5.0,
+        help="minimum change of the median in percent (default: 5)")
+    parser.add_argument("--alpha", type=float, default=0.01,
+        help="significance level of the Mann-Whitney U test (default: 0.01)")
+    args = parser.parse_args()
+
+    base = load(args.base)
+    new = load(args.new)
+
+    for field in ("cpu_model", "build_flags"):
+        if base.get(field) != new.get(field):
+            print(f"warning: {field} differs\n  base: {base.get(field)}\n  new:  {new.get(field)}")
+
+    rows, missing = compare(base, new, args.threshold, args.alpha)
+    regressions = [row for row in rows if row[3] > 0]
+    improvements = [row for row in rows if row[3] < 0]
+
+    for title, selected in (("regressions", regressions), ("improvements", improvements)):
+        if not selected:
+            continue
+        print(f"{title}:")
+        for (kernel, params), base_median, new_median, change, p, unit in sorted(selected, key=lambda row: -abs(row[3])):
+            print(f"  {kernel} [{params}]: {base_median:.1f}{unit} -> {new_median:.1f}{unit} ({change:+.1f}%, p={p:.2g})")
+
+    for kernel, params in missing:
+        print(f"missing in {args.new}: {kernel} [{params}]")
+
+    print(f"{len(regressions)} significant regressions, {len(improvements)} significant improvements")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,65 @@
+"""
+latency histogram with log-linear buckets in the style of HdrHistogram.
+Values below 2**precision_bits ns are stored exactly. Larger values are
+stored in buckets, which split every power of two into
+2**(precision_bits - 1) sub-buckets, so the relative error of a recorded
+value is below 2**(1 - precision_bits). Recording a value is O(1) and the
+memory only grows with the logarithm of the largest value, so every call of
+a benchmark can be recorded.
+"""
+import math
+
+
+class LatencyHistogram:
+    def __init__(self, precision_bits=7):
+        self.precision_bits = precision_bits
+        self.sub_buckets = 1 << (precision_bits - 1)
+        self.counts = []
+        self.total = 0
+        self.max = 0
+
+    def _index(self, value):
+        shift = value.bit_length() - self.precision_bits
+        if shift <= 0:
+            return value
+        return shift * self.sub_buckets + (value >> shift)
+
+    def _value(self, index):
+        """the highest value stored in the bucket"""
+        if index < 2 * self.sub_buckets:
+            return index
+        shift = index // self.sub_buckets - 1
+        mantissa = index - shift * self.sub_buckets
+        return ((mantissa + 1) << shift) - 1
+
+    def record(self, value_ns):
+        index = self._index(int(value_ns))
+        if index >= len(self.counts):
+            self.counts.extend([0] * (index + 1 - len(self.counts)))
+        self.counts[index] += 1
+        self.total += 1
+        self.max = max(self.max, int(value_ns))
+
+    def merge(self, other):
+        if len(other.counts) > len(self.counts):
+            self.counts.extend([0] * (len(other.counts) - len(self.counts)))
+        for index, count in enumerate(other.counts):
+            self.counts[index] += count
+        self.total += other.total
+        self.max = max(self.max, other.max)
+
+    def percentile(self, q):
+        """smallest recorded value, which is larger or equal to q * 100 percent of the values"""
+        if not self.total:
+            return 0
+        rank = max(1, math.ceil(q * self.total))
+        seen = 0
+        for index, count in enumerate(self.counts):
+            seen += count
+            if seen >= rank:
+                return min(self._value(index), self.max)
+        return self.max
+
+    def buckets(self):
+        """list of (highest value of the bucket in ns, count) for all non empty buckets"""
+        return [(self._value(index), count) for index, count in enumerate(self.counts) if count]
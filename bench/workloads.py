@@ -0,0 +1,218 @@
+"""
+seeded generators for benchmark corpora, which resemble the data process is
+used on: person names, postal addresses, product titles, token lists with a
+zipf distribution and CJK text. Queries are derived from entries of the corpus
+by an ErrorModel, which introduces typos, transpositions and reordered or
+dropped tokens with configurable rates.
+
+usage:
+  python workloads.py names --size 5 --typo 0.1 --shuffle 0.5
+prints a few entries of the corpus together with the derived queries
+"""
+import argparse
+import random
+
+FIRST_NAMES = [
+    "James", "Mary", "John", "Patricia", "Robert", "Jennifer", "Michael", "Linda",
+    "William", "Elizabeth", "David", "Barbara", "Richard", "Susan", "Joseph", "Jessica",
+    "Thomas", "Sarah", "Charles", "Karen", "Christopher", "Nancy", "Daniel", "Lisa",
+    "Matthew", "Betty", "Anthony", "Margaret", "Mark", "Sandra", "Donald", "Ashley",
+    "Steven", "Kimberly", "Paul", "Emily", "Andrew", "Donna", "Joshua", "Michelle",
+    "Kenneth", "Dorothy", "Kevin", "Carol", "Brian", "Amanda", "George", "Melissa",
+    "Jose", "Maria", "Luis", "Ana", "Hans", "Anna", "Jan", "Sofia", "Wei", "Yuki",
+]
+
+LAST_NAMES = [
+    "Smith", "Johnson", "Williams", "Brown", "Jones", "Garcia", "Miller", "Davis",
+    "Rodriguez", "Martinez", "Hernandez", "Lopez", "Gonzalez", "Wilson", "Anderson",
+    "Thomas", "Taylor", "Moore", "Jackson", "Martin", "Lee", "Perez", "Thompson",
+    "White", "Harris", "Sanchez", "Clark", "Ramirez", "Lewis", "Robinson", "Walker",
+    "Young", "Allen", "King", "Wright", "Scott", "Torres", "Nguyen", "Hill", "Flores",
+    "Green", "Adams", "Nelson", "Baker", "Hall", "Rivera", "Campbell", "Mitchell",
+    "Carter", "Roberts", "Mueller", "Schmidt", "Schneider", "Fischer", "Weber", "Tanaka",
+]
+
+STREETS = [
+    "Main", "Oak", "Pine", "Maple", "Cedar", "Elm", "Washington", "Lake", "Hill",
+    "Park", "Sunset", "Lincoln", "Church", "Highland", "Forest", "River", "Meadow",
+    "Spring", "Ridge", "Valley", "Jefferson", "Madison", "Franklin", "Jackson", "Center",
+]
+
+STREET_SUFFIXES = ["St", "Street", "Ave", "Avenue", "Rd", "Road", "Blvd", "Ln", "Lane", "Dr", "Ct", "Way"]
+
+CITIES = [
+    "Springfield", "Riverside", "Franklin", "Greenville", "Bristol", "Clinton",
+    "Fairview", "Salem", "Madison", "Georgetown", "Arlington", "Ashland", "Dover",
+    "Oxford", "Jackson", "Burlington", "Manchester", "Milton", "Newport", "Auburn",
+]
+
+STATES = ["AL", "AZ", "CA", "CO", "FL", "GA", "IL", "MA", "MI", "NY", "OH", "OR", "PA", "TX", "WA"]
+
+BRANDS = [
+    "Acme", "Contoso", "Globex", "Initech", "Umbrella", "Stark", "Wayne", "Hooli",
+    "Vandelay", "Wonka", "Soylent", "Tyrell", "Cyberdyne", "Aperture", "Oscorp",
+]
+
+ADJECTIVES = [
+    "Ultra", "Pro", "Mini", "Max", "Wireless", "Portable", "Compact", "Premium",
+    "Smart", "Classic", "Digital", "Ergonomic", "Waterproof", "Rechargeable", "Slim",
+]
+
+PRODUCTS = [
+    "Mouse", "Keyboard", "Headphones", "Speaker", "Charger", "Monitor", "Webcam",
+    "Router", "Backpack", "Water Bottle", "Desk Lamp", "Coffee Maker", "Blender",
+    "Toaster", "Vacuum Cleaner", "Power Bank", "USB Cable", "Phone Case", "Tablet Stand",
+]
+
+UNITS = ["GB", "TB", "mAh", "W", "ml", "cm", "inch", "dpi"]
+
+# a block of common CJK unified ideographs and the katakana block
+CJK_RANGES = [(0x4E00, 0x4E00 + 2500), (0x30A1, 0x30F6)]
+
+
+def names(size, rng):
+    result = []
+    for _ in range(size):
+        parts = [rng.choice(FIRST_NAMES)]
+        if rng.random() < 0.3:
+            parts.append(rng.choice(FIRST_NAMES)[0] + ".")
+        parts.append(rng.choice(LAST_NAMES))
+        result.append(" ".join(parts))
+    return result
+
+
+def addresses(size, rng):
+    return [
+        f"{rng.randint(1, 9999)} {rng.choice(STREETS)} {rng.choice(STREET_SUFFIXES)}, "
+        f"{rng.choice(CITIES)}, {rng.choice(STATES)} {rng.randint(10000, 99999)}"
+        for _ in range(size)
+    ]
+
+
+def titles(size, rng):
+    result = []
+    for _ in range(size):
+        parts = [rng.choice(BRANDS)]
+        parts += rng.sample(ADJECTIVES, rng.randint(0, 2))
+        parts.append(rng.choice(PRODUCTS))
+        if rng.random() < 0.6:
+            parts.append(f"{rng.choice([1, 2, 4, 8, 16, 32, 64, 128, 500, 1000])}{rng.choice(UNITS)}")
+        if rng.random() < 0.4:
+            parts.append(f"{rng.choice('ABCDEFGHKMSTX')}{rng.randint(100, 9999)}")
+        result.append(" ".join(parts))
+    return result
+
+
+def token_lists(size, rng, vocabulary_size=20000):
+    """space separated tokens, which are drawn from a vocabulary with a zipf distribution"""
+    vocabulary = ["".join(rng.choice("abcdefghijklmnopqrstuvwxyz") for _ in range(rng.randint(2, 10)))
+                  for _ in range(vocabulary_size)]
+    weights = [1 / (rank + 1) for rank in range(vocabulary_size)]
+    return [" ".join(rng.choices(vocabulary, weights, k=rng.randint(3, 12))) for _ in range(size)]
+
+
+def cjk(size, rng, vocabulary_size=5000):
+    """CJK text without separators built from words of one to four characters"""
+    def char():
+        start, stop = rng.choice(CJK_RANGES)
+        return chr(rng.randrange(start, stop))
+
+    vocabulary = ["".join(char() for _ in range(rng.randint(1, 4))) for _ in range(vocabulary_size)]
+    return ["".join(rng.choices(vocabulary, k=rng.randint(2, 8))) for _ in range(size)]
+
+
+CORPORA = {
+    "names": names,
+    "addresses": addresses,
+    "titles": titles,
+    "token_lists": token_lists,
+    "cjk": cjk,
+}
+
+
+class ErrorModel:
+    """
+    derives a query from an entry of the corpus:
+
+    - typo: probability of a substitution, insertion or deletion per character.
+      The inserted characters are taken from the string, so the alphabet of
+      the workload is preserved
+    - transposition: probability to swap a character with its successor
+    - shuffle: probability to shuffle the order of the tokens
+    - drop: probability to remove a token, as long as one token remains
+    """
+    def __init__(self, typo=0.0, transposition=0.0, shuffle=0.0, drop=0.0):
+        self.typo = typo
+        self.transposition = transposition
+        self.shuffle = shuffle
+        self.drop = drop
+
+    def __repr__(self):
+        return (f"ErrorModel(typo={self.typo}, transposition={self.transposition}, "
+                f"shuffle={self.shuffle}, drop={self.drop})")
+
+    def apply(self, s, rng):
+        tokens = s.split(" ")
+        if len(tokens) > 1:
+            tokens = [token for token in tokens if rng.random() >= self.drop] or [rng.choice(tokens)]
+            if rng.random() < self.shuffle:
+                rng.shuffle(tokens)
+        chars = list(" ".join(tokens))
+        if not chars:
+            return s
+
+        result = []
+        for c in chars:
+            if rng.random() < self.typo:
+                op = rng.randrange(3)
+                if op == 0:
+                    result.append(rng.choice(chars))
+                elif op == 1:
+                    result += [c, rng.choice(chars)]
+                continue
+            result.append(c)
+
+        for i in range(len(result) - 1):
+            if rng.random() < self.transposition:
+                result[i], result[i + 1] = result[i + 1], result[i]
+        return "".join(result)
+
+
+def make_workload(kind, size, query_count, error_model, seed=18):
+    """
+    returns a corpus of the given kind and size and query_count queries derived
+    from randomly selected entries of the corpus. Together with the entries the
+    queries were derived from, so the accuracy can be checked as well.
+    The same seed always generates the same workload.
+    """
+    rng = random.Random(seed)
+    choices = CORPORA[kind](size, rng)
+    targets = [rng.randrange(size) for _ in range(query_count)]
+    queries = [error_model.apply(choices[i], rng) for i in targets]
+    return choices, queries, targets
+
+
+def add_error_model_arguments(parser):
+    parser.add_argument("--typo", type=float, default=0.05, help="typo rate per character (default: 0.05)")
+    parser.add_argument("--transposition", type=float, default=0.02,
+        help="transposition rate per character (default: 0.02)")
+    parser.add_argument("--shuffle", type=float, default=0.2, help="probability to shuffle the tokens (default: 0.2)")
+    parser.add_argument("--drop", type=float, default=0.05, help="drop rate per token (default: 0.05)")
+
+
+def error_model_from_arguments(args):
+    return ErrorModel(typo=args.typo, transposition=args.transposition, shuffle=args.shuffle, drop=args.drop)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="print samples of a benchmark workload")
+    parser.add_argument("kind", choices=sorted(CORPORA))
+    parser.add_argument("--size", type=int, default=10)
+    parser.add_argument("--seed", type=int, default=18)
+    add_error_model_arguments(parser)
+    args = parser.parse_args()
+
+    choices, queries, targets = make_workload(args.kind, args.size, args.size,
+        error_model_from_arguments(args), args.seed)
+    for query, target in zip(queries, targets):
+        print(f"{choices[target]!r} -> {query!r}")
@@ -1,16 +1,18 @@
 from setuptools import setup, Extension
 from setuptools.command.build_ext import build_ext
+from Cython.Build import cythonize
+import os
 import sys
 
 class BuildExt(build_ext):
     """A custom build extension for adding compiler-specific options."""
     c_opts = {
         'msvc': ['/EHsc', '/O2', '/std:c++11', '/W4', '/DNDEBUG'],
-        'unix': ['-O3', '-std=c++11', '-Wextra', '-Wall', '-Wconversion', '-g0', '-DNDEBUG'],
+        'unix': ['-O3', '-std=c++11', '-Wextra', '-Wall', '-Wconversion', '-g0', '-DNDEBUG', '-pthread'],
     }
     l_opts = {
         'msvc': [],
-        'unix': [],
+        'unix': ['-pthread'],
     }
 
     if sys.platform == 'darwin':
@@ -24,6 +26,9 @@ class BuildExt(build_ext):
         link_opts = self.l_opts.get(ct, [])
         if ct == 'unix':
             opts.append('-DVERSION_INFO="%s"' % self.distribution.get_version())
+            # static tracepoints for perf/bpftrace, see src/cpp_trace.hpp
+            if os.environ.get('RAPIDFUZZ_TRACEPOINTS'):
+                opts.append('-DRAPIDFUZZ_USDT')
         elif ct == 'msvc':
             opts.append('/DVERSION_INFO=\\"%s\\"' % self.distribution.get_version())
         for ext in self.extensions:
@@ -35,7 +40,7 @@ ext_modules = [
     Extension(
        name='rapidfuzz.cpp_process',
         sources=[
-            'src/cpp_process.cpp',
+            'src/cpp_process.pyx',
             'src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp'
         ],
         include_dirs=["src/rapidfuzz-cpp/"],
@@ -44,7 +49,7 @@ ext_modules = [
     Extension(
         name='rapidfuzz.cpp_fuzz',
         sources=[
-            'src/cpp_fuzz.cpp',
+            'src/cpp_fuzz.pyx',
             'src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp'
         ],
         include_dirs=["src/rapidfuzz-cpp/"],
@@ -53,7 +58,7 @@ ext_modules = [
     Extension(
         name='rapidfuzz.cpp_string_metric',
         sources=[
-            'src/cpp_string_metric.cpp',
+            'src/cpp_string_metric.pyx',
             'src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp'
         ],
         include_dirs=["src/rapidfuzz-cpp/"],
@@ -62,7 +67,7 @@ ext_modules = [
     Extension(
         name='rapidfuzz.cpp_utils',
         sources=[
-            'src/cpp_utils.cpp',
+            'src/cpp_utils.pyx',
             'src/rapidfuzz-cpp/rapidfuzz/details/unicode.cpp'
         ],
         include_dirs=["src/rapidfuzz-cpp/"],
@@ -74,5 +79,6 @@ ext_modules = [
 if __name__ == "__main__":
     setup(
         cmdclass={'build_ext': BuildExt},
-        ext_modules = ext_modules
+        # the C++ sources are generated from the .pyx files during the build
+        ext_modules = cythonize(ext_modules, language_level=3)
     )
@@ -0,0 +1,339 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/* helpers shared by the bit-parallel kernels implemented in this directory.
+ * They only depend on the standard library, so every kernel works with any
+ * Sentence type, that provides size() and operator[]
+ */
+namespace detail {
+
+static inline std::size_t popcount64(uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<std::size_t>(__popcnt64(x));
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<std::size_t>((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/* index of the lowest set bit. x is not allowed to be 0 */
+static inline std::size_t countr_zero(uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<std::size_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(x));
+#else
+    std::size_t index = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/* isolate the lowest set bit */
+static inline uint64_t blsi(uint64_t x)
+{
+    return x & (~x + 1);
+}
+
+/* reset the lowest set bit */
+static inline uint64_t blsr(uint64_t x)
+{
+    return x & (x - 1);
+}
+
+/* mask with the lowest `len` bits set. len has to be <= 64 */
+static inline uint64_t bit_mask_lsb(std::size_t len)
+{
+    return (len >= 64) ? ~UINT64_C(0) : (UINT64_C(1) << len) - 1;
+}
+
+static inline uint64_t addc64(uint64_t a, uint64_t b, uint64_t carryin, uint64_t* carryout)
+{
+    a += carryin;
+    *carryout = (a < carryin);
+    a += b;
+    *carryout |= (a < b);
+    return a;
+}
+
+static inline std::size_t ceil_div(std::size_t a, std::size_t divisor)
+{
+    return a / divisor + static_cast<std::size_t>(a % divisor != 0);
+}
+
+/* maximum distance, that can still reach a normalized score of score_cutoff.
+ * The result is rounded up, so the final score still has to be compared to
+ * score_cutoff
+ */
+static inline std::size_t score_cutoff_to_distance(double score_cutoff, std::size_t lensum)
+{
+    return static_cast<std::size_t>(std::ceil(static_cast<double>(lensum) * (1.0 - score_cutoff / 100)));
+}
+
+/* normalize a distance to a score between 0 and 100. A distance of
+ * (std::size_t)-1 is the result of a distance exceeding max
+ */
+static inline double norm_distance(std::size_t dist, std::size_t lensum, double score_cutoff)
+{
+    if (dist == static_cast<std::size_t>(-1)) {
+        return 0.0;
+    }
+
+    double score = lensum ? 100.0 - 100.0 * static_cast<double>(dist) / static_cast<double>(lensum) : 100.0;
+    return (score >= score_cutoff) ? score : 0.0;
+}
+
+/* all character types are compared as uint64_t, so e.g. a uint8_t string
+ * can be compared to a hashed sequence of uint64_t
+ */
+template <typename CharT>
+static inline uint64_t char_key(CharT ch)
+{
+    return static_cast<uint64_t>(ch);
+}
+
+template <typename CharT1, typename CharT2>
+static inline bool char_equal(CharT1 a, CharT2 b)
+{
+    return char_key(a) == char_key(b);
+}
+
+/* hashmap used for characters >= 256. A single block can only hold 64
+ * different characters, so 128 slots guarantee a free slot for each key.
+ * The probing sequence is the same one used by CPython for dicts.
+ */
+struct BitvectorHashmap {
+    struct MapElem {
+        uint64_t key;
+        uint64_t value;
+    };
+
+    BitvectorHashmap() : m_map() {}
+
+    uint64_t get(uint64_t key) const
+    {
+        return m_map[lookup(key)].value;
+    }
+
+    uint64_t& operator[](uint64_t key)
+    {
+        std::size_t i = lookup(key);
+        m_map[i].key = key;
+        return m_map[i].value;
+    }
+
+private:
+    std::size_t lookup(uint64_t key) const
+    {
+        std::size_t i = static_cast<std::size_t>(key % 128);
+
+        if (!m_map[i].value || m_map[i].key == key) {
+            return i;
+        }
+
+        uint64_t perturb = key;
+        while (true) {
+            i = (i * 5 + static_cast<std::size_t>(perturb) + 1) % 128;
+            if (!m_map[i].value || m_map[i].key == key) {
+                return i;
+            }
+            perturb >>= 5;
+        }
+    }
+
+    std::array<MapElem, 128> m_map;
+};
+
+/* match bitvectors of a pattern with up to 64 characters */
+struct PatternMatchVector {
+    PatternMatchVector() : m_map(), m_extendedAscii() {}
+
+    template <typename Sentence>
+    explicit PatternMatchVector(const Sentence& s) : m_map(), m_extendedAscii()
+    {
+        uint64_t mask = 1;
+        for (std::size_t i = 0; i < s.size() && i < 64; ++i) {
+            insert_mask(char_key(s[i]), mask);
+            mask <<= 1;
+        }
+    }
+
+    template <typename CharT>
+    uint64_t get(CharT ch) const
+    {
+        uint64_t key = char_key(ch);
+        if (key < 256) {
+            return m_extendedAscii[static_cast<std::size_t>(key)];
+        }
+        return m_map.get(key);
+    }
+
+    /* allows the usage in kernels written for a BlockPatternMatchVector */
+    template <typename CharT>
+    uint64_t get(std::size_t, CharT ch) const
+    {
+        return get(ch);
+    }
+
+    void insert_mask(uint64_t key, uint64_t mask)
+    {
+        if (key < 256) {
+            m_extendedAscii[static_cast<std::size_t>(key)] |= mask;
+        } else {
+            m_map[key] |= mask;
+        }
+    }
+
+private:
+    BitvectorHashmap m_map;
+    std::array<uint64_t, 256> m_extendedAscii;
+};
+
+/* match bitvectors of a pattern with an arbitrary length split into
+ * blocks of 64 characters. The bitvectors of the extended ASCII characters
+ * are stored character-major, so all blocks accessed for a single character
+ * of the text are stored next to each other in memory
+ */
+struct BlockPatternMatchVector {
+    BlockPatternMatchVector() : m_block_count(0) {}
+
+    template <typename Sentence>
+    explicit BlockPatternMatchVector(const Sentence& s) : m_block_count(0)
+    {
+        insert(s);
+    }
+
+    template <typename Sentence>
+    void insert(const Sentence& s)
+    {
+        std::size_t len = s.size();
+        init(ceil_div(len, 64));
+
+        for (std::size_t i = 0; i < len; ++i) {
+            insert_mask(i / 64, char_key(s[i]), UINT64_C(1) << (i % 64));
+        }
+    }
+
+    /* empty bitvectors for `block_count` blocks, which are filled using insert_mask */
+    void init(std::size_t block_count)
+    {
+        m_block_count = block_count;
+        m_extendedAscii.assign(256 * m_block_count, 0);
+        m_map.clear();
+    }
+
+    void insert_mask(std::size_t block, uint64_t key, uint64_t mask)
+    {
+        if (key < 256) {
+            m_extendedAscii[static_cast<std::size_t>(key) * m_block_count + block] |= mask;
+        } else {
+            /* the hashmaps are only allocated when they are required */
+            if (m_map.empty()) {
+                m_map.resize(m_block_count);
+            }
+            m_map[block][key] |= mask;
+        }
+    }
+
+    std::size_t size() const
+    {
+        return m_block_count;
+    }
+
+    template <typename CharT>
+    uint64_t get(std::size_t block, CharT ch) const
+    {
+        uint64_t key = char_key(ch);
+        if (key < 256) {
+            return m_extendedAscii[static_cast<std::size_t>(key) * m_block_count + block];
+        }
+        if (m_map.empty()) {
+            return 0;
+        }
+        return m_map[block].get(key);
+    }
+
+private:
+    std::size_t m_block_count;
+    std::vector<BitvectorHashmap> m_map;
+    std::vector<uint64_t> m_extendedAscii;
+};
+
+struct Affix {
+    std::size_t prefix_len;
+    std::size_t suffix_len;
+};
+
+/* length of the common prefix and suffix of s1 and s2. The suffix never
+ * overlaps the prefix
+ */
+template <typename Sentence1, typename Sentence2>
+static inline Affix common_affix(const Sentence1& s1, const Sentence2& s2)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+
+    std::size_t prefix = 0;
+    while (prefix < len1 && prefix < len2 && char_equal(s1[prefix], s2[prefix])) {
+        ++prefix;
+    }
+
+    std::size_t suffix = 0;
+    while (suffix < len1 - prefix && suffix < len2 - prefix &&
+           char_equal(s1[len1 - suffix - 1], s2[len2 - suffix - 1]))
+    {
+        ++suffix;
+    }
+
+    return {prefix, suffix};
+}
+
+/* lightweight view on a part of a Sentence, which is used after removing
+ * the common affix without copying the string
+ */
+template <typename Sentence>
+struct SubSentence {
+    const Sentence* str;
+    std::size_t first;
+    std::size_t len;
+
+    SubSentence(const Sentence& s, std::size_t _first, std::size_t _len)
+      : str(&s), first(_first), len(_len) {}
+
+    std::size_t size() const
+    {
+        return len;
+    }
+
+    auto operator[](std::size_t i) const -> decltype((*str)[i])
+    {
+        return (*str)[first + i];
+    }
+};
+
+template <typename Sentence>
+static inline SubSentence<Sentence> sub_sentence(const Sentence& s, std::size_t first, std::size_t len)
+{
+    return SubSentence<Sentence>(s, first, len);
+}
+
+} // namespace detail
@@ -4,6 +4,12 @@
 #include <rapidfuzz/fuzz.hpp>
 #include <rapidfuzz/utils.hpp>
 #include <rapidfuzz/string_metric.hpp>
+#include "cpp_levenshtein.hpp"
+#include "cpp_damerau_levenshtein.hpp"
+#include "cpp_indel.hpp"
+#include "cpp_jaro.hpp"
+#include "cpp_hamming.hpp"
+#include "cpp_partial_ratio.hpp"
 #include <exception>
 #include <iostream>
 
@@ -262,7 +268,7 @@ DISTANCE_IMPL_INNER(RATIO, RATIO_FUNC, no_process)
 
 /* fuzz */
 RATIO_IMPL_DEF(ratio,                    fuzz::ratio)
-RATIO_IMPL_DEF(partial_ratio,            fuzz::partial_ratio)
+RATIO_IMPL_DEF(partial_ratio,            detail::partial_ratio)
 RATIO_IMPL_DEF(token_sort_ratio,         fuzz::token_sort_ratio)
 RATIO_IMPL_DEF(token_set_ratio,          fuzz::token_set_ratio)
 RATIO_IMPL_DEF(token_ratio,              fuzz::token_ratio)
@@ -273,12 +279,21 @@ RATIO_IMPL_DEF(WRatio,                   fuzz::WRatio)
 RATIO_IMPL_DEF(QRatio,                   fuzz::QRatio)
 
 /* string_metric */
-DISTANCE_IMPL_DEF(levenshtein,           string_metric::levenshtein)
+DISTANCE_IMPL_DEF(levenshtein,           detail::levenshtein)
+DISTANCE_IMPL_DEF(levenshtein_parallel,  detail::levenshtein_parallel)
 RATIO_IMPL_DEF(normalized_levenshtein,   string_metric::normalized_levenshtein)
-DISTANCE_IMPL_DEF(hamming,               string_metric::hamming)
-RATIO_IMPL_DEF(normalized_hamming,       string_metric::normalized_hamming)
-RATIO_IMPL_DEF(jaro_winkler_similarity,  string_metric::jaro_winkler_similarity)
-RATIO_IMPL_DEF(jaro_similarity,          string_metric::jaro_similarity)
+DISTANCE_IMPL_DEF(hamming,               detail::hamming_distance)
+RATIO_IMPL_DEF(normalized_hamming,       detail::normalized_hamming)
+RATIO_IMPL_DEF(jaro_winkler_similarity,  detail::jaro_winkler_similarity)
+RATIO_IMPL_DEF(jaro_similarity,          detail::jaro_similarity)
+DISTANCE_IMPL_DEF(osa,                   detail::osa_distance)
+RATIO_IMPL_DEF(normalized_osa,           detail::normalized_osa)
+DISTANCE_IMPL_DEF(damerau_levenshtein,   detail::damerau_levenshtein_distance)
+RATIO_IMPL_DEF(normalized_damerau_levenshtein, detail::normalized_damerau_levenshtein)
+DISTANCE_IMPL_DEF(indel,                 detail::indel_distance)
+RATIO_IMPL_DEF(normalized_indel,         detail::normalized_indel)
+/* the similarity is a size_t as well, so the same wrappers can be used */
+DISTANCE_IMPL_DEF(lcs_seq,               detail::lcs_seq_similarity)
 
 # undef X_ENUM
 
@@ -0,0 +1,344 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace detail {
+
+/* Optimal string alignment distance (restricted Damerau-Levenshtein) based on
+ * Hyyrö's bit-parallel algorithm for patterns with up to 64 characters.
+ * Returns (std::size_t)-1 when the distance is larger than max.
+ */
+template <typename Sentence2>
+std::size_t osa_hyrroe2003(const PatternMatchVector& PM, std::size_t len1, const Sentence2& s2, std::size_t max)
+{
+    uint64_t VP = ~UINT64_C(0);
+    uint64_t VN = 0;
+    uint64_t D0 = 0;
+    uint64_t PM_j_old = 0;
+    std::size_t currDist = len1;
+    const uint64_t mask = UINT64_C(1) << (len1 - 1);
+
+    for (std::size_t j = 0; j < s2.size(); ++j) {
+        uint64_t PM_j = PM.get(s2[j]);
+        uint64_t TR = (((~D0) & PM_j) << 1) & PM_j_old;
+        D0 = (((PM_j & VP) + VP) ^ VP) | PM_j | VN | TR;
+
+        uint64_t HP = VN | ~(D0 | VP);
+        uint64_t HN = D0 & VP;
+
+        currDist += static_cast<std::size_t>((HP & mask) != 0);
+        currDist -= static_cast<std::size_t>((HN & mask) != 0);
+
+        HP = (HP << 1) | 1;
+        HN = HN << 1;
+
+        VP = HN | ~(D0 | HP);
+        VN = HP & D0;
+        PM_j_old = PM_j;
+    }
+
+    return (currDist <= max) ? currDist : static_cast<std::size_t>(-1);
+}
+
+/* blockwise implementation of osa_hyrroe2003. A transposition can cross the
+ * border between two blocks, so the transposition mask of each block
+ * requires the last bit of D0 and of the match vector of the block below.
+ */
+template <typename Sentence2>
+std::size_t osa_hyrroe2003_block(const BlockPatternMatchVector& PM, std::size_t len1, const Sentence2& s2,
+    std::size_t max)
+{
+    struct Row {
+        uint64_t VP;
+        uint64_t VN;
+        uint64_t D0;
+        uint64_t PM;
+    };
+
+    const std::size_t words = PM.size();
+    const uint64_t Last = UINT64_C(1) << ((len1 - 1) % 64);
+    std::size_t currDist = len1;
+
+    /* index 0 is a sentinel for the block below the first block */
+    std::vector<Row> old_vecs(words + 1, Row{~UINT64_C(0), 0, 0, 0});
+    std::vector<Row> new_vecs(words + 1, Row{~UINT64_C(0), 0, 0, 0});
+
+    for (std::size_t j = 0; j < s2.size(); ++j) {
+        std::swap(old_vecs, new_vecs);
+        uint64_t HP_carry = 1;
+        uint64_t HN_carry = 0;
+
+        for (std::size_t word = 0; word < words; ++word) {
+            uint64_t PM_j = PM.get(word, s2[j]);
+            uint64_t VN = old_vecs[word + 1].VN;
+            uint64_t VP = old_vecs[word + 1].VP;
+            uint64_t D0 = old_vecs[word + 1].D0;
+            uint64_t D0_last = old_vecs[word].D0;
+            uint64_t PM_last = new_vecs[word].PM;
+            uint64_t PM_j_old = old_vecs[word + 1].PM;
+
+            uint64_t X = PM_j;
+            uint64_t TR = ((((~D0) & X) << 1) | (((~D0_last) & PM_last) >> 63)) & PM_j_old;
+            X |= HN_carry;
+            D0 = (((X & VP) + VP) ^ VP) | X | VN | TR;
+
+            uint64_t HP = VN | ~(D0 | VP);
+            uint64_t HN = D0 & VP;
+
+            if (word == words - 1) {
+                currDist += static_cast<std::size_t>((HP & Last) != 0);
+                currDist -= static_cast<std::size_t>((HN & Last) != 0);
+            }
+
+            uint64_t HP_carry_temp = HP_carry;
+            HP_carry = HP >> 63;
+            HP = (HP << 1) | HP_carry_temp;
+            uint64_t HN_carry_temp = HN_carry;
+            HN_carry = HN >> 63;
+            HN = (HN << 1) | HN_carry_temp;
+
+            new_vecs[word + 1].VP = HN | ~(D0 | HP);
+            new_vecs[word + 1].VN = HP & D0;
+            new_vecs[word + 1].D0 = D0;
+            new_vecs[word + 1].PM = PM_j;
+        }
+    }
+
+    return (currDist <= max) ? currDist : static_cast<std::size_t>(-1);
+}
+
+template <typename Sentence1, typename Sentence2>
+std::size_t osa_distance(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    /* a transposition does not cross the common affix, so it can be removed */
+    Affix affix = common_affix(s1, s2);
+    std::size_t len1 = s1.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len2 = s2.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len_diff = (len1 > len2) ? len1 - len2 : len2 - len1;
+
+    if (len_diff > max) {
+        return static_cast<std::size_t>(-1);
+    }
+
+    if (!len1) {
+        return len2;
+    }
+
+    auto sub1 = sub_sentence(s1, affix.prefix_len, len1);
+    auto sub2 = sub_sentence(s2, affix.prefix_len, len2);
+
+    if (len1 <= 64) {
+        return osa_hyrroe2003(PatternMatchVector(sub1), len1, sub2, max);
+    }
+
+    return osa_hyrroe2003_block(BlockPatternMatchVector(sub1), len1, sub2, max);
+}
+
+template <typename Sentence1, typename Sentence2>
+double normalized_osa(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    std::size_t lensum = std::max(s1.size(), s2.size());
+    std::size_t max = score_cutoff_to_distance(score_cutoff, lensum);
+    return norm_distance(osa_distance(s1, s2, max), lensum, score_cutoff);
+}
+
+/* last row in which each character of s1 occured. Characters, that did
+ * not occur yet, are mapped to -1
+ */
+struct LastRowMap {
+    LastRowMap()
+    {
+        m_extendedAscii.fill(-1);
+    }
+
+    std::ptrdiff_t get(uint64_t key) const
+    {
+        if (key < 256) {
+            return m_extendedAscii[static_cast<std::size_t>(key)];
+        }
+
+        auto it = m_map.find(key);
+        return (it == m_map.end()) ? -1 : it->second;
+    }
+
+    void set(uint64_t key, std::ptrdiff_t row)
+    {
+        if (key < 256) {
+            m_extendedAscii[static_cast<std::size_t>(key)] = row;
+        } else {
+            m_map[key] = row;
+        }
+    }
+
+private:
+    std::unordered_map<uint64_t, std::ptrdiff_t> m_map;
+    std::array<std::ptrdiff_t, 256> m_extendedAscii;
+};
+
+/* unrestricted Damerau-Levenshtein distance based on the algorithm by Zhao.
+ * Only the last two rows of the matrix and the last occurence of each
+ * character are stored, so it requires O(N) memory and O(N*M) time.
+ * Returns (std::size_t)-1 when the distance is larger than max.
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t damerau_levenshtein_zhao(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    std::ptrdiff_t len1 = static_cast<std::ptrdiff_t>(s1.size());
+    std::ptrdiff_t len2 = static_cast<std::ptrdiff_t>(s2.size());
+    std::ptrdiff_t maxVal = std::max(len1, len2) + 1;
+    LastRowMap last_row_id;
+
+    std::size_t size = s2.size() + 2;
+    std::vector<std::ptrdiff_t> FR_arr(size, maxVal);
+    std::vector<std::ptrdiff_t> R1_arr(size, maxVal);
+    std::vector<std::ptrdiff_t> R_arr(size);
+    R_arr[0] = maxVal;
+    for (std::size_t i = 1; i < size; ++i) {
+        R_arr[i] = static_cast<std::ptrdiff_t>(i) - 1;
+    }
+
+    /* index -1 is accessed for transpositions at the start of s2 */
+    std::ptrdiff_t* R = &R_arr[1];
+    std::ptrdiff_t* R1 = &R1_arr[1];
+    std::ptrdiff_t* FR = &FR_arr[1];
+
+    for (std::ptrdiff_t i = 1; i <= len1; ++i) {
+        std::swap(R, R1);
+        std::ptrdiff_t last_col_id = -1;
+        std::ptrdiff_t last_i2l1 = R[0];
+        R[0] = i;
+        std::ptrdiff_t T = maxVal;
+        uint64_t ch1 = char_key(s1[static_cast<std::size_t>(i - 1)]);
+
+        for (std::ptrdiff_t j = 1; j <= len2; ++j) {
+            uint64_t ch2 = char_key(s2[static_cast<std::size_t>(j - 1)]);
+            std::ptrdiff_t diag = R1[j - 1] + static_cast<std::ptrdiff_t>(ch1 != ch2);
+            std::ptrdiff_t left = R[j - 1] + 1;
+            std::ptrdiff_t up = R1[j] + 1;
+            std::ptrdiff_t temp = std::min(diag, std::min(left, up));
+
+            if (ch1 == ch2) {
+                last_col_id = j;   /* last occurence of s1[i - 1] */
+                FR[j] = R1[j - 2]; /* save H[k - 1][j - 2] */
+                T = last_i2l1;     /* save H[i - 2][l - 1] */
+            } else {
+                std::ptrdiff_t k = last_row_id.get(ch2);
+                std::ptrdiff_t l = last_col_id;
+
+                if ((j - l) == 1) {
+                    temp = std::min(temp, FR[j] + (i - k));
+                } else if ((i - k) == 1) {
+                    temp = std::min(temp, T + (j - l));
+                }
+            }
+
+            last_i2l1 = R[j];
+            R[j] = temp;
+        }
+
+        last_row_id.set(ch1, i);
+    }
+
+    std::size_t dist = static_cast<std::size_t>(R[len2]);
+    return (dist <= max) ? dist : static_cast<std::size_t>(-1);
+}
+
+template <typename Sentence1, typename Sentence2>
+std::size_t damerau_levenshtein_distance(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    Affix affix = common_affix(s1, s2);
+    std::size_t len1 = s1.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len2 = s2.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len_diff = (len1 > len2) ? len1 - len2 : len2 - len1;
+
+    if (len_diff > max) {
+        return static_cast<std::size_t>(-1);
+    }
+
+    return damerau_levenshtein_zhao(
+        sub_sentence(s1, affix.prefix_len, len1),
+        sub_sentence(s2, affix.prefix_len, len2),
+        max);
+}
+
+template <typename Sentence1, typename Sentence2>
+double normalized_damerau_levenshtein(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    std::size_t lensum = std::max(s1.size(), s2.size());
+    std::size_t max = score_cutoff_to_distance(score_cutoff, lensum);
+    return norm_distance(damerau_levenshtein_distance(s1, s2, max), lensum, score_cutoff);
+}
+
+/* cached scorers used by process.extract/extractOne/extract_iter.
+ * The match vectors of s1 are only created once for all choices
+ */
+template <typename Sentence1>
+struct CachedOSA {
+    Sentence1 s1;
+    BlockPatternMatchVector PM;
+
+    explicit CachedOSA(const Sentence1& _s1) : s1(_s1), PM(_s1) {}
+
+    template <typename Sentence2>
+    std::size_t distance(const Sentence2& s2, std::size_t max = static_cast<std::size_t>(-1)) const
+    {
+        std::size_t len1 = s1.size();
+        std::size_t len2 = s2.size();
+        std::size_t len_diff = (len1 > len2) ? len1 - len2 : len2 - len1;
+
+        if (len_diff > max) {
+            return static_cast<std::size_t>(-1);
+        }
+
+        if (!len1) {
+            return (len2 <= max) ? len2 : static_cast<std::size_t>(-1);
+        }
+
+        return osa_hyrroe2003_block(PM, len1, s2, max);
+    }
+};
+
+template <typename Sentence1>
+struct CachedNormalizedOSA {
+    CachedOSA<Sentence1> scorer;
+
+    explicit CachedNormalizedOSA(const Sentence1& s1) : scorer(s1) {}
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        std::size_t lensum = std::max(scorer.s1.size(), s2.size());
+        std::size_t max = score_cutoff_to_distance(score_cutoff, lensum);
+        return norm_distance(scorer.distance(s2, max), lensum, score_cutoff);
+    }
+};
+
+template <typename Sentence1>
+struct CachedDamerauLevenshtein {
+    Sentence1 s1;
+
+    explicit CachedDamerauLevenshtein(const Sentence1& _s1) : s1(_s1) {}
+
+    template <typename Sentence2>
+    std::size_t distance(const Sentence2& s2, std::size_t max = static_cast<std::size_t>(-1)) const
+    {
+        return damerau_levenshtein_distance(s1, s2, max);
+    }
+};
+
+template <typename Sentence1>
+struct CachedNormalizedDamerauLevenshtein {
+    Sentence1 s1;
+
+    explicit CachedNormalizedDamerauLevenshtein(const Sentence1& _s1) : s1(_s1) {}
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        return normalized_damerau_levenshtein(s1, s2, score_cutoff);
+    }
+};
+
+} // namespace detail
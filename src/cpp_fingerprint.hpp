@@ -0,0 +1,349 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <algorithm>
+#include <exception>
+#include <queue>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace detail {
+
+struct FingerprintMatch {
+    std::size_t distance;
+    std::size_t index;
+};
+
+/* matches are sorted by distance and matches with the same distance by index */
+struct FingerprintMatchComp {
+    bool operator()(const FingerprintMatch& a, const FingerprintMatch& b) const
+    {
+        if (a.distance != b.distance) {
+            return a.distance < b.distance;
+        }
+        return a.index < b.index;
+    }
+};
+
+/* scans below this size are always performed by a single thread */
+static const std::size_t fingerprint_min_chunk = 1 << 15;
+
+/* calls func(first, last, chunk) for up to `workers` consecutive chunks of
+ * [0, count) on separate threads. workers == 0 uses all available cores.
+ * Returns the amount of chunks. An exception thrown by func is rethrown
+ * after all threads are joined.
+ */
+template <typename Func>
+std::size_t fingerprint_parallel_for(std::size_t count, std::size_t workers, Func func)
+{
+    if (workers == 0) {
+        workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    std::size_t chunks = std::max<std::size_t>(std::min(workers, count / fingerprint_min_chunk), 1);
+    std::size_t chunk_size = ceil_div(count, chunks);
+    if (chunks == 1) {
+        func(0, count, 0);
+        return 1;
+    }
+
+    /* exceptions can not leave a thread, so they are stored per chunk */
+    std::vector<std::exception_ptr> errors(chunks);
+    auto run = [&](std::size_t first, std::size_t last, std::size_t chunk) {
+        try {
+            func(first, last, chunk);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks - 1);
+
+    std::size_t started = 1;
+    try {
+        for (; started < chunks; ++started) {
+            std::size_t first = started * chunk_size;
+            threads.emplace_back(run, first, std::min(first + chunk_size, count), started);
+        }
+    } catch (const std::system_error&) {
+        /* the remaining chunks are processed by this thread below */
+    }
+
+    run(0, std::min(chunk_size, count), 0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t chunk = started; chunk < chunks; ++chunk) {
+        std::size_t first = chunk * chunk_size;
+        run(first, std::min(first + chunk_size, count), chunk);
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return chunks;
+}
+
+/* corpus of binary fingerprints like perceptual hashes with a fixed amount
+ * of bits. The fingerprints are stored one after another in a contiguous
+ * uint64_t array and compared using xor + popcount. Radius searches can use
+ * multi-index hashing (Norouzi et al.): the fingerprints are split into m
+ * substrings and every fingerprint within a distance r of the query has at
+ * least one substring within a distance of r / m of the corresponding
+ * substring of the query, so only fingerprints sharing a substring, which is
+ * close to the query are compared.
+ */
+class FingerprintCorpus {
+public:
+    explicit FingerprintCorpus(std::size_t bits) : m_bits(bits), m_words(bits / 64)
+    {
+        if (!bits || bits % 64) {
+            throw std::invalid_argument("bits has to be a positive multiple of 64");
+        }
+    }
+
+    std::size_t bits() const
+    {
+        return m_bits;
+    }
+
+    std::size_t size() const
+    {
+        return m_data.size() / m_words;
+    }
+
+    const uint64_t* get(std::size_t index) const
+    {
+        return &m_data[index * m_words];
+    }
+
+    void add(const uint64_t* fingerprint)
+    {
+        std::size_t index = size();
+        m_data.insert(m_data.end(), fingerprint, fingerprint + m_words);
+        for (std::size_t table = 0; table < m_tables.size(); ++table) {
+            m_tables[table][substring(fingerprint, table)].push_back(index);
+        }
+    }
+
+    std::size_t distance(const uint64_t* query, std::size_t index) const
+    {
+        const uint64_t* fingerprint = get(index);
+        std::size_t dist = 0;
+        for (std::size_t w = 0; w < m_words; ++w) {
+            dist += popcount64(query[w] ^ fingerprint[w]);
+        }
+        return dist;
+    }
+
+    /* the `limit` fingerprints closest to the query with a distance <= max */
+    std::vector<FingerprintMatch> extract(const uint64_t* query, std::size_t limit, std::size_t max,
+                                          std::size_t workers) const
+    {
+        typedef std::priority_queue<FingerprintMatch, std::vector<FingerprintMatch>, FingerprintMatchComp> Heap;
+        std::vector<FingerprintMatch> results;
+        if (!limit) {
+            return results;
+        }
+
+        std::vector<Heap> heaps(workers ? workers : std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+        std::size_t chunks = fingerprint_parallel_for(size(), workers,
+            [&](std::size_t first, std::size_t last, std::size_t chunk) {
+                Heap& heap = heaps[chunk];
+                std::size_t chunk_max = max;
+                for (std::size_t i = first; i < last; ++i) {
+                    std::size_t dist = distance(query, i);
+                    if (dist > chunk_max) {
+                        continue;
+                    }
+
+                    heap.push({dist, i});
+                    if (heap.size() > limit) {
+                        heap.pop();
+                    }
+                    /* only better matches can enter a full heap */
+                    if (heap.size() == limit) {
+                        chunk_max = heap.top().distance;
+                    }
+                }
+            });
+
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            Heap& heap = heaps[chunk];
+            for (; !heap.empty(); heap.pop()) {
+                results.push_back(heap.top());
+            }
+        }
+
+        std::sort(results.begin(), results.end(), FingerprintMatchComp());
+        if (results.size() > limit) {
+            results.resize(limit);
+        }
+        return results;
+    }
+
+    /* all fingerprints with a distance <= radius to the query */
+    std::vector<FingerprintMatch> extract_radius(const uint64_t* query, std::size_t radius,
+                                                 std::size_t workers) const
+    {
+        if (use_index(radius)) {
+            return extract_radius_index(query, radius);
+        }
+
+        std::vector<std::vector<FingerprintMatch>> matches(
+            workers ? workers : std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+        std::size_t chunks = fingerprint_parallel_for(size(), workers,
+            [&](std::size_t first, std::size_t last, std::size_t chunk) {
+                for (std::size_t i = first; i < last; ++i) {
+                    std::size_t dist = distance(query, i);
+                    if (dist <= radius) {
+                        matches[chunk].push_back({dist, i});
+                    }
+                }
+            });
+
+        std::vector<FingerprintMatch> results;
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            results.insert(results.end(), matches[chunk].begin(), matches[chunk].end());
+        }
+
+        std::sort(results.begin(), results.end(), FingerprintMatchComp());
+        return results;
+    }
+
+    /* build the hash tables for multi-index hashing using `substrings` substrings
+     * with up to 64 bits each
+     */
+    void build_index(std::size_t substrings)
+    {
+        if (!substrings || substrings > m_bits || ceil_div(m_bits, substrings) > 64) {
+            throw std::invalid_argument("substrings has to be between bits / 64 and bits");
+        }
+
+        m_tables.assign(substrings, SubstringTable());
+        for (std::size_t i = 0; i < size(); ++i) {
+            for (std::size_t table = 0; table < substrings; ++table) {
+                m_tables[table][substring(get(i), table)].push_back(i);
+            }
+        }
+    }
+
+    std::size_t index_substrings() const
+    {
+        return m_tables.size();
+    }
+
+private:
+    typedef std::unordered_map<uint64_t, std::vector<std::size_t>> SubstringTable;
+
+    std::size_t substring_first_bit(std::size_t table) const
+    {
+        return table * m_bits / m_tables.size();
+    }
+
+    std::size_t substring_len(std::size_t table) const
+    {
+        return substring_first_bit(table + 1) - substring_first_bit(table);
+    }
+
+    /* bits of the substring `table` of the fingerprint. A substring can span two words */
+    uint64_t substring(const uint64_t* fingerprint, std::size_t table) const
+    {
+        std::size_t first = substring_first_bit(table);
+        std::size_t len = substring_len(table);
+        std::size_t word = first / 64;
+        std::size_t offset = first % 64;
+
+        uint64_t bits = fingerprint[word] >> offset;
+        if (offset && offset + len > 64) {
+            bits |= fingerprint[word + 1] << (64 - offset);
+        }
+        return bits & bit_mask_lsb(len);
+    }
+
+    /* the index only helps as long as the amount of probed keys is small
+     * compared to the corpus size
+     */
+    bool use_index(std::size_t radius) const
+    {
+        if (m_tables.empty()) {
+            return false;
+        }
+
+        std::size_t flips = radius / m_tables.size();
+        std::size_t probes = 0;
+        for (std::size_t table = 0; table < m_tables.size(); ++table) {
+            std::size_t len = substring_len(table);
+            /* sum of binomial coefficients C(len, 0..flips) */
+            std::size_t binomial = 1;
+            std::size_t sum = 1;
+            for (std::size_t k = 1; k <= flips && k <= len; ++k) {
+                binomial = binomial * (len - k + 1) / k;
+                sum += binomial;
+                if (sum > size()) {
+                    return false;
+                }
+            }
+            probes += sum;
+        }
+        return probes <= size();
+    }
+
+    template <typename Func>
+    static void for_each_neighbor(uint64_t key, std::size_t first_bit, std::size_t len, std::size_t flips,
+                                  Func& func)
+    {
+        func(key);
+        if (!flips) {
+            return;
+        }
+
+        for (std::size_t bit = first_bit; bit < len; ++bit) {
+            for_each_neighbor(key ^ (UINT64_C(1) << bit), bit + 1, len, flips - 1, func);
+        }
+    }
+
+    std::vector<FingerprintMatch> extract_radius_index(const uint64_t* query, std::size_t radius) const
+    {
+        std::size_t flips = radius / m_tables.size();
+        std::vector<std::size_t> candidates;
+
+        for (std::size_t table = 0; table < m_tables.size(); ++table) {
+            const SubstringTable& substrings = m_tables[table];
+            auto lookup = [&](uint64_t key) {
+                auto it = substrings.find(key);
+                if (it != substrings.end()) {
+                    candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+                }
+            };
+            for_each_neighbor(substring(query, table), 0, substring_len(table), flips, lookup);
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        std::vector<FingerprintMatch> results;
+        for (std::size_t index : candidates) {
+            std::size_t dist = distance(query, index);
+            if (dist <= radius) {
+                results.push_back({dist, index});
+            }
+        }
+
+        std::sort(results.begin(), results.end(), FingerprintMatchComp());
+        return results;
+    }
+
+    std::size_t m_bits;
+    std::size_t m_words;
+    std::vector<uint64_t> m_data;
+    std::vector<SubstringTable> m_tables;
+};
+
+} // namespace detail
@@ -5,6 +5,7 @@
 from rapidfuzz.utils import default_process
 from cpp_common cimport proc_string, is_valid_string, convert_string, hash_array, hash_sequence
 from array import array
+from collections import namedtuple
 from libcpp.utility cimport move
 
 cdef inline proc_string conv_sequence(seq) except *:
@@ -37,6 +38,22 @@ cdef extern from "cpp_scorer.hpp":
     double QRatio_no_process(                        const proc_string&, const proc_string&, double) nogil except +
     double QRatio_default_process(                   const proc_string&, const proc_string&, double) nogil except +
 
+    ctypedef struct CppScoreAlignment "detail::ScoreAlignment":
+        double score
+        size_t src_start
+        size_t src_end
+        size_t dest_start
+        size_t dest_end
+
+    CppScoreAlignment partial_ratio_alignment_no_process(     const proc_string&, const proc_string&, double) nogil except +
+    CppScoreAlignment partial_ratio_alignment_default_process(const proc_string&, const proc_string&, double) nogil except +
+
+ScoreAlignment = namedtuple("ScoreAlignment", ["score", "src_start", "src_end", "dest_start", "dest_end"])
+ScoreAlignment.__doc__ = """
+Alignment found by partial_ratio_alignment. ``s1[src_start:src_end]``
+is compared to ``s2[dest_start:dest_end]`` to calculate the score.
+"""
+
 def ratio(s1, s2, *, processor=None, score_cutoff=None):
     """
     calculates a simple ratio between two strings. This is a simple wrapper
@@ -133,6 +150,61 @@ def partial_ratio(s1, s2, *, processor=None, score_cutoff=None):
     return partial_ratio_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
 
 
+
+def partial_ratio_alignment(s1, s2, *, processor=None, score_cutoff=None):
+    """
+    calculates the fuzz.partial_ratio of s1 and s2 and returns it together
+    with the alignment, the score was calculated for
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. The positions refer to the processed strings.
+        Default is None, which deactivates this behaviour.
+    score_cutoff : float, optional
+        Optional argument for a score threshold as a float between 0 and 100.
+        For ratio < score_cutoff None is returned instead. Default is 0,
+        which deactivates this behaviour.
+
+    Returns
+    -------
+    alignment : ScoreAlignment, optional
+        Named tuple `(score, src_start, src_end, dest_start, dest_end)`.
+        ``s1[src_start:src_end]`` is the part of s1 compared to
+        ``s2[dest_start:dest_end]``, which resulted in the score.
+        The alignment is found in the same pass as the score, so this is
+        as fast as partial_ratio.
+
+    Examples
+    --------
+    >>> fuzz.partial_ratio_alignment("a needle", "this is a needle in a haystack")
+    ScoreAlignment(score=100.0, src_start=0, src_end=8, dest_start=8, dest_end=16)
+    """
+    cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+    cdef CppScoreAlignment res
+
+    if s1 is None or s2 is None:
+        return None
+
+    if processor is True or processor == default_process:
+        res = partial_ratio_alignment_default_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+    else:
+        if callable(processor):
+            s1 = processor(s1)
+            s2 = processor(s2)
+        res = partial_ratio_alignment_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+
+    if res.score < c_score_cutoff:
+        return None
+    return ScoreAlignment(res.score, res.src_start, res.src_end, res.dest_start, res.dest_end)
+
+
 def token_sort_ratio(s1, s2, *, processor=True, score_cutoff=None):
     """
     sorts the words in the strings and calculates the fuzz.ratio between them
@@ -0,0 +1,355 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPIDFUZZ_HAMMING_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace detail {
+
+/* mask with the highest bit of each code unit set, when a 64 bit word
+ * is split into code units with a width of `width` bytes
+ */
+static inline uint64_t swar_high_mask(std::size_t width)
+{
+    uint64_t mask = 0;
+    for (std::size_t bit = width * 8 - 1; bit < 64; bit += width * 8) {
+        mask |= UINT64_C(1) << bit;
+    }
+    return mask;
+}
+
+/* sets the lowest bit of each code unit of the type CharT in x, which is not 0 */
+template <typename CharT>
+static inline uint64_t nonzero_units(uint64_t x)
+{
+    const uint64_t high = swar_high_mask(sizeof(CharT));
+    return ((((x & ~high) + ~high) | x) & high) >> (sizeof(CharT) * 8 - 1);
+}
+
+/* sum of all code units of the type CharT in x. The sum has to fit into a single code unit */
+template <typename CharT>
+static inline std::size_t sum_units(uint64_t x)
+{
+    const uint64_t ones = swar_high_mask(sizeof(CharT)) >> (sizeof(CharT) * 8 - 1);
+    return static_cast<std::size_t>((x * ones) >> (64 - sizeof(CharT) * 8));
+}
+
+static inline uint64_t load_word(const void* ptr)
+{
+    uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    return word;
+}
+
+/* hamming distance for strings with the same character type. 64 bytes are
+ * compared at a time by xoring 64 bit words and marking the code units, that
+ * are not zero. The marks of a block are summed up per code unit, so only a
+ * single horizontal sum is required per block. Returns (std::size_t)-1 as soon
+ * as the distance exceeds max
+ */
+template <typename CharT>
+std::size_t hamming_impl(const CharT* s1, const CharT* s2, std::size_t len, std::size_t max)
+{
+    const std::size_t word_units = sizeof(uint64_t) / sizeof(CharT);
+    const std::size_t block_units = 8 * word_units;
+    std::size_t dist = 0;
+    std::size_t i = 0;
+
+    for (; i + block_units <= len; i += block_units) {
+        uint64_t mismatches = 0;
+        for (std::size_t w = 0; w < 8; ++w) {
+            std::size_t pos = i + w * word_units;
+            mismatches += nonzero_units<CharT>(load_word(s1 + pos) ^ load_word(s2 + pos));
+        }
+        dist += sum_units<CharT>(mismatches);
+
+        if (dist > max) {
+            return static_cast<std::size_t>(-1);
+        }
+    }
+
+    for (; i < len; ++i) {
+        dist += static_cast<std::size_t>(s1[i] != s2[i]);
+    }
+
+    return (dist <= max) ? dist : static_cast<std::size_t>(-1);
+}
+
+/* hamming distance for strings with different character types. The mismatches
+ * are counted in blocks of 64 characters, so max is only checked once per block
+ */
+template <typename CharT1, typename CharT2>
+std::size_t hamming_impl(const CharT1* s1, const CharT2* s2, std::size_t len, std::size_t max)
+{
+    std::size_t dist = 0;
+    std::size_t i = 0;
+
+    for (; i + 64 <= len; i += 64) {
+        for (std::size_t k = 0; k < 64; ++k) {
+            dist += static_cast<std::size_t>(!char_equal(s1[i + k], s2[i + k]));
+        }
+
+        if (dist > max) {
+            return static_cast<std::size_t>(-1);
+        }
+    }
+
+    for (; i < len; ++i) {
+        dist += static_cast<std::size_t>(!char_equal(s1[i], s2[i]));
+    }
+
+    return (dist <= max) ? dist : static_cast<std::size_t>(-1);
+}
+
+template <typename Sentence1, typename Sentence2>
+std::size_t hamming_distance(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    if (s1.size() != s2.size()) {
+        throw std::invalid_argument("s1 and s2 are not the same length.");
+    }
+
+    return hamming_impl(s1.data(), s2.data(), s1.size(), max);
+}
+
+template <typename Sentence1, typename Sentence2>
+double normalized_hamming(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    std::size_t len = s1.size();
+    std::size_t max = score_cutoff_to_distance(score_cutoff, len);
+    return norm_distance(hamming_distance(s1, s2, max), len, score_cutoff);
+}
+
+/* amount of choices scored at once by hamming_corpus */
+static const std::size_t hamming_batch_size = 64;
+
+/* marks the positions of the 16 characters starting at s1 and s2, that are
+ * not equal, in the lowest 16 bits of the result
+ */
+struct HammingMismatchScalar {
+    template <typename CharT>
+    static uint64_t mask16(const CharT* s1, const CharT* s2)
+    {
+        uint64_t mask = 0;
+        for (std::size_t i = 0; i < 16; ++i) {
+            mask |= static_cast<uint64_t>(s1[i] != s2[i]) << i;
+        }
+        return mask;
+    }
+};
+
+#ifdef RAPIDFUZZ_HAMMING_SSE2
+/* the comparisons of wider characters are packed into bytes, so a single
+ * movemask returns the mismatches of all 16 characters. Characters with 64
+ * bits use the scalar comparison, since SSE2 has no 64 bit compare
+ */
+struct HammingMismatchSSE2 {
+    template <typename CharT>
+    static uint64_t mask16(const CharT* s1, const CharT* s2)
+    {
+        return HammingMismatchScalar::mask16(s1, s2);
+    }
+
+    static uint64_t mask16(const uint8_t* s1, const uint8_t* s2)
+    {
+        return mismatches(_mm_cmpeq_epi8(load(s1), load(s2)));
+    }
+
+    static uint64_t mask16(const uint16_t* s1, const uint16_t* s2)
+    {
+        __m128i eq0 = _mm_cmpeq_epi16(load(s1), load(s2));
+        __m128i eq1 = _mm_cmpeq_epi16(load(s1 + 8), load(s2 + 8));
+        return mismatches(_mm_packs_epi16(eq0, eq1));
+    }
+
+    static uint64_t mask16(const uint32_t* s1, const uint32_t* s2)
+    {
+        __m128i eq0 = _mm_cmpeq_epi32(load(s1), load(s2));
+        __m128i eq1 = _mm_cmpeq_epi32(load(s1 + 4), load(s2 + 4));
+        __m128i eq2 = _mm_cmpeq_epi32(load(s1 + 8), load(s2 + 8));
+        __m128i eq3 = _mm_cmpeq_epi32(load(s1 + 12), load(s2 + 12));
+        return mismatches(_mm_packs_epi16(_mm_packs_epi32(eq0, eq1), _mm_packs_epi32(eq2, eq3)));
+    }
+
+private:
+    static __m128i load(const void* ptr)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    }
+
+    static uint64_t mismatches(__m128i eq)
+    {
+        return static_cast<uint64_t>(~static_cast<unsigned>(_mm_movemask_epi8(eq)) & 0xFFFFu);
+    }
+};
+
+typedef HammingMismatchSSE2 HammingMismatchSIMD;
+#else
+typedef HammingMismatchScalar HammingMismatchSIMD;
+#endif
+
+/* amount of bits set in bits[start, start + len) with len <= 64 */
+static inline std::size_t popcount_range(const uint64_t* bits, std::size_t start, std::size_t len)
+{
+    std::size_t word = start / 64;
+    std::size_t offset = start % 64;
+    uint64_t range = bits[word] >> offset;
+    if (offset + len > 64) {
+        range |= bits[word + 1] << (64 - offset);
+    }
+    return popcount64(range & bit_mask_lsb(len));
+}
+
+/* hamming distance of the query to each of the `count` codes stored one after
+ * another in codes. All codes have the same length as the query, which has
+ * 1 - 64 characters and is stored `count` times one after another in
+ * repeated, so both buffers are compared 16 characters at a time without
+ * regard to the boundaries of the codes. This compares several codes in
+ * one step, when they are shorter than 16 characters. The distance of each
+ * code is the amount of mismatches in its range of the resulting bit vector.
+ * Both buffers have to be padded by 64 characters
+ */
+template <typename Mismatch = HammingMismatchSIMD, typename CharT>
+void hamming_corpus(const CharT* repeated, const CharT* codes, std::size_t len, std::size_t count,
+                    std::size_t max, std::size_t* distances)
+{
+    uint64_t mismatches[hamming_batch_size];
+    std::size_t words = ceil_div(len * count, 64);
+    for (std::size_t word = 0; word < words; ++word) {
+        std::size_t pos = word * 64;
+        mismatches[word] = Mismatch::mask16(repeated + pos, codes + pos)
+                           | Mismatch::mask16(repeated + pos + 16, codes + pos + 16) << 16
+                           | Mismatch::mask16(repeated + pos + 32, codes + pos + 32) << 32
+                           | Mismatch::mask16(repeated + pos + 48, codes + pos + 48) << 48;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t dist = popcount_range(mismatches, i * len, len);
+        distances[i] = (dist <= max) ? dist : static_cast<std::size_t>(-1);
+    }
+}
+
+/* a batch of choices with the same length as the query, which are copied
+ * into a single buffer using the character type of the query
+ */
+template <typename CharT>
+struct HammingCorpus {
+    std::size_t count;
+    std::vector<CharT> codes;
+
+    HammingCorpus() : count(0), codes(hamming_batch_size * 64 + 64) {}
+
+    template <typename Sentence>
+    void insert(const Sentence& s)
+    {
+        std::copy(s.begin(), s.end(), codes.begin() + static_cast<std::ptrdiff_t>(count * s.size()));
+        ++count;
+    }
+
+    void clear()
+    {
+        count = 0;
+    }
+};
+
+/* cached scorers used by process.extract/extractOne/extract_iter */
+template <typename Sentence1>
+struct CachedHamming {
+    typedef typename Sentence1::value_type CharT1;
+    Sentence1 s1;
+    /* s1 repeated once for each lane of a batch */
+    std::vector<CharT1> repeated;
+
+    explicit CachedHamming(const Sentence1& _s1) : s1(_s1)
+    {
+        if (batch_supported()) {
+            repeated.resize(hamming_batch_size * s1.size() + 64);
+            for (std::size_t i = 0; i < hamming_batch_size; ++i) {
+                std::copy(s1.begin(), s1.end(), repeated.begin() + static_cast<std::ptrdiff_t>(i * s1.size()));
+            }
+        }
+    }
+
+    template <typename Sentence2>
+    std::size_t distance(const Sentence2& s2, std::size_t max = static_cast<std::size_t>(-1)) const
+    {
+        return hamming_distance(s1, s2, max);
+    }
+
+    /* batched scoring used by process.extract/extractOne. Longer strings are
+     * compared one by one, since hamming_impl already compares them 64 bytes
+     * at a time
+     */
+    typedef HammingCorpus<CharT1> Batch;
+    static const std::size_t batch_size = hamming_batch_size;
+
+    bool batch_supported() const
+    {
+        return !s1.empty() && s1.size() <= 64;
+    }
+
+    /* choices with a different length raise an exception in distance() and
+     * choices with a wider character type can not be stored in the batch
+     */
+    template <typename Sentence2>
+    bool batch_insert(Batch& batch, const Sentence2& s2) const
+    {
+        if (s2.size() != s1.size() || sizeof(typename Sentence2::value_type) > sizeof(CharT1)) {
+            return false;
+        }
+
+        batch.insert(s2);
+        return true;
+    }
+
+    void batch_distance(Batch& batch, std::size_t max, std::size_t* distances) const
+    {
+        hamming_corpus(repeated.data(), batch.codes.data(), s1.size(), batch.count, max, distances);
+    }
+};
+
+template <typename Sentence1>
+struct CachedNormalizedHamming {
+    CachedHamming<Sentence1> scorer;
+
+    explicit CachedNormalizedHamming(const Sentence1& s1) : scorer(s1) {}
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        std::size_t len = scorer.s1.size();
+        std::size_t max = score_cutoff_to_distance(score_cutoff, len);
+        return norm_distance(scorer.distance(s2, max), len, score_cutoff);
+    }
+
+    typedef typename CachedHamming<Sentence1>::Batch Batch;
+    static const std::size_t batch_size = CachedHamming<Sentence1>::batch_size;
+
+    bool batch_supported() const
+    {
+        return scorer.batch_supported();
+    }
+
+    template <typename Sentence2>
+    bool batch_insert(Batch& batch, const Sentence2& s2) const
+    {
+        return scorer.batch_insert(batch, s2);
+    }
+
+    void batch_ratio(Batch& batch, double score_cutoff, double* scores) const
+    {
+        std::size_t len = scorer.s1.size();
+        std::size_t distances[batch_size];
+        scorer.batch_distance(batch, score_cutoff_to_distance(score_cutoff, len), distances);
+        for (std::size_t i = 0; i < batch.count; ++i) {
+            scores[i] = norm_distance(distances[i], len, score_cutoff);
+        }
+    }
+};
+
+} // namespace detail
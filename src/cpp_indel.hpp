@@ -0,0 +1,72 @@
+#pragma once
+#include <rapidfuzz/string_metric.hpp>
+
+namespace detail {
+
+/* The InDel distance is the Levenshtein distance with a weight of 2 for
+ * substitutions, so it is calculated by the weighted Levenshtein distance
+ * of rapidfuzz-cpp, which uses the bit-parallel LCS kernel behind fuzz.ratio.
+ * Since InDel = len1 + len2 - 2 * LCS, the LCS length is derived from it.
+ */
+static const rapidfuzz::LevenshteinWeightTable indel_weights = {1, 1, 2};
+
+/* maximum InDel distance, that allows a LCS length >= score_cutoff */
+static inline std::size_t lcs_cutoff_to_indel_max(std::size_t lensum, std::size_t score_cutoff)
+{
+    return (score_cutoff <= lensum / 2) ? lensum - 2 * score_cutoff : 0;
+}
+
+/* Returns (std::size_t)-1 when the distance is larger than max */
+template <typename Sentence1, typename Sentence2>
+std::size_t indel_distance(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    return rapidfuzz::string_metric::levenshtein(s1, s2, indel_weights, max);
+}
+
+template <typename Sentence1, typename Sentence2>
+double normalized_indel(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    return rapidfuzz::string_metric::normalized_levenshtein(s1, s2, indel_weights, score_cutoff);
+}
+
+/* length of the longest common subsequence of s1 and s2. Returns 0 when it
+ * is shorter than score_cutoff
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t lcs_seq_similarity(const Sentence1& s1, const Sentence2& s2, std::size_t score_cutoff)
+{
+    /* the LCS can not be longer than the shorter string */
+    std::size_t lensum = s1.size() + s2.size();
+    if (score_cutoff > lensum / 2) {
+        return 0;
+    }
+
+    std::size_t dist = indel_distance(s1, s2, lcs_cutoff_to_indel_max(lensum, score_cutoff));
+    return (dist != static_cast<std::size_t>(-1)) ? (lensum - dist) / 2 : 0;
+}
+
+/* cached scorer used by process.extract/extractOne/extract_iter. The cached
+ * InDel scorers are rapidfuzz-cpp's CachedLevenshtein and
+ * CachedNormalizedLevenshtein with indel_weights
+ */
+template <typename Sentence1>
+struct CachedLCSseq {
+    std::size_t len1;
+    rapidfuzz::string_metric::CachedLevenshtein<Sentence1> scorer;
+
+    explicit CachedLCSseq(const Sentence1& s1) : len1(s1.size()), scorer(s1, indel_weights) {}
+
+    template <typename Sentence2>
+    std::size_t similarity(const Sentence2& s2, std::size_t score_cutoff = 0) const
+    {
+        std::size_t lensum = len1 + s2.size();
+        if (score_cutoff > lensum / 2) {
+            return 0;
+        }
+
+        std::size_t dist = scorer.distance(s2, lcs_cutoff_to_indel_max(lensum, score_cutoff));
+        return (dist != static_cast<std::size_t>(-1)) ? (lensum - dist) / 2 : 0;
+    }
+};
+
+} // namespace detail
@@ -0,0 +1,526 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#define RAPIDFUZZ_JARO_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPIDFUZZ_JARO_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace detail {
+
+/* strings up to this length are matched using the scalar implementation,
+ * since the search window is so small, that building the match vectors
+ * takes longer than the matching itself
+ */
+static const std::size_t jaro_scalar_max_len = 16;
+
+/* characters are only considered matching, when they are not farther
+ * apart than max(len1, len2) / 2 - 1
+ */
+static inline std::size_t jaro_bound(std::size_t len1, std::size_t len2)
+{
+    std::size_t bound = std::max(len1, len2) / 2;
+    return bound ? bound - 1 : 0;
+}
+
+static inline double jaro_calculate_similarity(std::size_t len1, std::size_t len2,
+                                               std::size_t common, std::size_t transpositions)
+{
+    double m = static_cast<double>(common);
+    double t = static_cast<double>(transpositions / 2);
+    return 100.0 * (m / static_cast<double>(len1) + m / static_cast<double>(len2) + (m - t) / m) / 3.0;
+}
+
+/* the similarity can only reach score_cutoff, when it is reached when all
+ * characters of the shorter string match without any transpositions
+ */
+static inline bool jaro_length_filter(std::size_t len1, std::size_t len2, double score_cutoff)
+{
+    if (!len1 || !len2) {
+        return false;
+    }
+
+    return jaro_calculate_similarity(len1, len2, std::min(len1, len2), 0) >= score_cutoff;
+}
+
+/* scalar implementation for short strings. The flags are stored as bits,
+ * since both strings have at most jaro_scalar_max_len characters
+ */
+template <typename Sentence1, typename Sentence2>
+double jaro_similarity_scalar(const Sentence1& P, const Sentence2& T, double score_cutoff)
+{
+    std::size_t len1 = P.size();
+    std::size_t len2 = T.size();
+    if (!jaro_length_filter(len1, len2, score_cutoff)) {
+        return 0.0;
+    }
+
+    std::size_t bound = jaro_bound(len1, len2);
+    uint64_t P_flag = 0;
+    uint64_t T_flag = 0;
+    std::size_t common = 0;
+
+    for (std::size_t i = 0; i < len2; ++i) {
+        std::size_t lowlim = (i >= bound) ? i - bound : 0;
+        std::size_t hilim = std::min(i + bound, len1 - 1);
+        for (std::size_t j = lowlim; j <= hilim; ++j) {
+            if (!(P_flag & (UINT64_C(1) << j)) && char_equal(P[j], T[i])) {
+                P_flag |= UINT64_C(1) << j;
+                T_flag |= UINT64_C(1) << i;
+                ++common;
+                break;
+            }
+        }
+    }
+
+    if (!common) {
+        return 0.0;
+    }
+
+    std::size_t transpositions = 0;
+    while (T_flag) {
+        std::size_t i = countr_zero(T_flag);
+        std::size_t j = countr_zero(P_flag);
+        if (!char_equal(T[i], P[j])) {
+            ++transpositions;
+        }
+        T_flag = blsr(T_flag);
+        P_flag = blsr(P_flag);
+    }
+
+    double sim = jaro_calculate_similarity(len1, len2, common, transpositions);
+    return (sim >= score_cutoff) ? sim : 0.0;
+}
+
+/* bit-parallel implementation of the jaro similarity. For each character of T
+ * the first unflagged match inside the search window is found using the match
+ * vectors of P, so the window is processed 64 characters at a time. The
+ * transpositions are counted by walking the flagged bits of P and T in parallel.
+ * PM can either be a PatternMatchVector or a BlockPatternMatchVector of P.
+ */
+template <typename PM_Vec, typename Sentence2>
+double jaro_bitparallel(const PM_Vec& PM, std::size_t len1, const Sentence2& T, double score_cutoff)
+{
+    std::size_t len2 = T.size();
+    if (!jaro_length_filter(len1, len2, score_cutoff)) {
+        return 0.0;
+    }
+
+    std::size_t bound = jaro_bound(len1, len2);
+    std::vector<uint64_t> P_flag(ceil_div(len1, 64), 0);
+    std::vector<uint64_t> T_flag(ceil_div(len2, 64), 0);
+    std::size_t common = 0;
+
+    /* characters of T behind len1 + bound can not have a match in P */
+    std::size_t T_end = std::min(len2, len1 + bound);
+    for (std::size_t i = 0; i < T_end; ++i) {
+        std::size_t lowlim = (i >= bound) ? i - bound : 0;
+        std::size_t hilim = std::min(i + bound, len1 - 1);
+        std::size_t first_word = lowlim / 64;
+        std::size_t last_word = hilim / 64;
+
+        for (std::size_t w = first_word; w <= last_word; ++w) {
+            uint64_t window = ~UINT64_C(0);
+            if (w == first_word) {
+                window &= ~bit_mask_lsb(lowlim % 64);
+            }
+            if (w == last_word) {
+                window &= bit_mask_lsb(hilim % 64 + 1);
+            }
+
+            uint64_t candidates = PM.get(w, T[i]) & ~P_flag[w] & window;
+            if (candidates) {
+                P_flag[w] |= blsi(candidates);
+                T_flag[i / 64] |= UINT64_C(1) << (i % 64);
+                ++common;
+                break;
+            }
+        }
+    }
+
+    if (!common || jaro_calculate_similarity(len1, len2, common, 0) < score_cutoff) {
+        return 0.0;
+    }
+
+    std::size_t transpositions = 0;
+    std::size_t P_word = 0;
+    uint64_t P_cur = P_flag[0];
+    for (std::size_t T_word = 0; T_word < T_flag.size(); ++T_word) {
+        uint64_t T_cur = T_flag[T_word];
+        while (T_cur) {
+            std::size_t i = T_word * 64 + countr_zero(T_cur);
+            while (!P_cur) {
+                P_cur = P_flag[++P_word];
+            }
+
+            if (!(PM.get(P_word, T[i]) & blsi(P_cur))) {
+                ++transpositions;
+            }
+            T_cur = blsr(T_cur);
+            P_cur = blsr(P_cur);
+        }
+    }
+
+    double sim = jaro_calculate_similarity(len1, len2, common, transpositions);
+    return (sim >= score_cutoff) ? sim : 0.0;
+}
+
+template <typename Sentence1, typename Sentence2>
+double jaro_similarity(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+
+    if (len1 <= jaro_scalar_max_len && len2 <= jaro_scalar_max_len) {
+        return jaro_similarity_scalar(s1, s2, score_cutoff);
+    }
+
+    if (!jaro_length_filter(len1, len2, score_cutoff)) {
+        return 0.0;
+    }
+
+    if (len1 <= 64) {
+        return jaro_bitparallel(PatternMatchVector(s1), len1, s2, score_cutoff);
+    }
+    return jaro_bitparallel(BlockPatternMatchVector(s1), len1, s2, score_cutoff);
+}
+
+static inline void jaro_winkler_check_prefix_weight(double prefix_weight)
+{
+    if (prefix_weight < 0.0 || prefix_weight > 0.25) {
+        throw std::invalid_argument("prefix_weight has to be between 0.0 - 0.25");
+    }
+}
+
+/* length of the common prefix, which is limited to 4 characters */
+template <typename Sentence1, typename Sentence2>
+std::size_t jaro_winkler_prefix(const Sentence1& s1, const Sentence2& s2)
+{
+    std::size_t max_prefix = std::min(std::min(s1.size(), s2.size()), static_cast<std::size_t>(4));
+    std::size_t prefix = 0;
+    while (prefix < max_prefix && char_equal(s1[prefix], s2[prefix])) {
+        ++prefix;
+    }
+    return prefix;
+}
+
+/* score_cutoff for the jaro similarity. The prefix is only taken into account
+ * for jaro similarities above 70, so when the prefix can increase the score,
+ * the jaro similarity only has to reach 70
+ */
+static inline double jaro_winkler_jaro_cutoff(std::size_t prefix, double prefix_weight, double score_cutoff)
+{
+    if (!prefix || prefix_weight == 0.0) {
+        return score_cutoff;
+    }
+    return std::min(score_cutoff, 70.0);
+}
+
+static inline double jaro_winkler_from_jaro(double sim, std::size_t prefix, double prefix_weight, double score_cutoff)
+{
+    if (sim > 70) {
+        sim += static_cast<double>(prefix) * prefix_weight * (100.0 - sim);
+    }
+    return (sim >= score_cutoff) ? sim : 0.0;
+}
+
+template <typename Sentence1, typename Sentence2>
+double jaro_winkler_similarity(const Sentence1& s1, const Sentence2& s2, double prefix_weight, double score_cutoff)
+{
+    jaro_winkler_check_prefix_weight(prefix_weight);
+
+    std::size_t prefix = jaro_winkler_prefix(s1, s2);
+    double sim = jaro_similarity(s1, s2, jaro_winkler_jaro_cutoff(prefix, prefix_weight, score_cutoff));
+    return jaro_winkler_from_jaro(sim, prefix, prefix_weight, score_cutoff);
+}
+
+/* amount of choices scored at once by jaro_winkler_batch */
+static const std::size_t jaro_batch_lanes = 16;
+
+/* a batch of choices with up to 64 characters, that is compared to the same
+ * query with up to 64 characters. Only the match vectors of the query for each
+ * character of the choices are stored, so the kernel does not depend on the
+ * character type of the choices. They are stored position-major, so a
+ * single position of all lanes is stored next to each other in memory.
+ * window_match is the match vector limited to the search window of the
+ * position, which depends on the length of the choice, so all lanes are
+ * matched using the same instructions
+ */
+template <std::size_t Lanes>
+struct JaroBatch {
+    std::size_t count;
+    std::size_t max_len2;
+    std::array<std::size_t, Lanes> len2;
+    std::array<std::size_t, Lanes> prefix;
+    std::array<std::array<uint64_t, Lanes>, 64> match;
+    std::array<std::array<uint64_t, Lanes>, 64> window_match;
+
+    JaroBatch() : count(0), max_len2(0) {}
+
+    template <typename PM_Vec, typename Sentence1, typename Sentence2>
+    void insert(const PM_Vec& PM, const Sentence1& s1, const Sentence2& s2)
+    {
+        std::size_t lane = count++;
+        std::size_t len1 = s1.size();
+        std::size_t len = s2.size();
+        std::size_t bound = jaro_bound(len1, len);
+        for (std::size_t i = 0; i < len; ++i) {
+            std::size_t lowlim = (i >= bound) ? i - bound : 0;
+            std::size_t hilim = std::min(i + bound, len1 - 1);
+            match[i][lane] = PM.get(0, s2[i]);
+            window_match[i][lane] = match[i][lane] & bit_mask_lsb(hilim + 1) & ~bit_mask_lsb(lowlim);
+        }
+        len2[lane] = len;
+        prefix[lane] = jaro_winkler_prefix(s1, s2);
+        max_len2 = std::max(max_len2, len);
+    }
+
+    void clear()
+    {
+        count = 0;
+        max_len2 = 0;
+    }
+};
+
+/* matches the character at position i of the choices in `lanes` lanes. For
+ * each lane the first unflagged character of the query in the search window
+ * is flagged in P_flag and position i is flagged in T_flag, when there is one.
+ * Lanes with a lane_mask of 0 are not matched
+ */
+struct JaroMatchScalar {
+    static const std::size_t width = 1;
+
+    static void match(const uint64_t* window_match, const uint64_t* lane_mask,
+                      uint64_t* P_flag, uint64_t* T_flag, std::size_t i, std::size_t lanes)
+    {
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            uint64_t candidates = window_match[lane] & ~P_flag[lane] & lane_mask[lane];
+            P_flag[lane] |= blsi(candidates);
+            T_flag[lane] |= static_cast<uint64_t>(candidates != 0) << i;
+        }
+    }
+};
+
+#if defined(RAPIDFUZZ_JARO_AVX2)
+/* four lanes per register */
+struct JaroMatchAVX2 {
+    static const std::size_t width = 4;
+
+    static void match(const uint64_t* window_match, const uint64_t* lane_mask,
+                      uint64_t* P_flag, uint64_t* T_flag, std::size_t i, std::size_t lanes)
+    {
+        const __m256i one = _mm256_set1_epi64x(1);
+        const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(i));
+        for (std::size_t lane = 0; lane < lanes; lane += width) {
+            __m256i P = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P_flag + lane));
+            __m256i T = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(T_flag + lane));
+            __m256i candidates = _mm256_andnot_si256(P, _mm256_and_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(window_match + lane)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lane_mask + lane))));
+            __m256i low = _mm256_and_si256(candidates, _mm256_sub_epi64(_mm256_setzero_si256(), candidates));
+            __m256i found = _mm256_andnot_si256(_mm256_cmpeq_epi64(low, _mm256_setzero_si256()), one);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(P_flag + lane), _mm256_or_si256(P, low));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(T_flag + lane), _mm256_or_si256(T, _mm256_sll_epi64(found, shift)));
+        }
+    }
+};
+typedef JaroMatchAVX2 JaroMatchSIMD;
+#elif defined(RAPIDFUZZ_JARO_SSE2)
+/* two lanes per register. SSE2 has no 64 bit comparison, so whether a match
+ * was found is calculated from the lowest candidate: (low - 1) >> 63 is 1 only
+ * when low is 0
+ */
+struct JaroMatchSSE2 {
+    static const std::size_t width = 2;
+
+    static void match(const uint64_t* window_match, const uint64_t* lane_mask,
+                      uint64_t* P_flag, uint64_t* T_flag, std::size_t i, std::size_t lanes)
+    {
+        const __m128i one = _mm_set_epi32(0, 1, 0, 1);
+        const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(i));
+        for (std::size_t lane = 0; lane < lanes; lane += width) {
+            __m128i P = _mm_loadu_si128(reinterpret_cast<const __m128i*>(P_flag + lane));
+            __m128i T = _mm_loadu_si128(reinterpret_cast<const __m128i*>(T_flag + lane));
+            __m128i candidates = _mm_andnot_si128(P, _mm_and_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(window_match + lane)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lane_mask + lane))));
+            __m128i low = _mm_and_si128(candidates, _mm_sub_epi64(_mm_setzero_si128(), candidates));
+            __m128i found = _mm_xor_si128(_mm_srli_epi64(_mm_sub_epi64(low, one), 63), one);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(P_flag + lane), _mm_or_si128(P, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(T_flag + lane), _mm_or_si128(T, _mm_sll_epi64(found, shift)));
+        }
+    }
+};
+typedef JaroMatchSSE2 JaroMatchSIMD;
+#else
+typedef JaroMatchScalar JaroMatchSIMD;
+#endif
+
+/* jaro winkler similarity of a query with len1 characters to all choices of
+ * the batch. The lanes are matched in lockstep by Match, which is
+ * JaroMatchSIMD by default. Lanes, that can no longer reach score_cutoff are
+ * removed from the lane mask and the batch is abandoned, when no lane is left
+ */
+template <typename Match = JaroMatchSIMD, std::size_t Lanes>
+void jaro_winkler_batch(JaroBatch<Lanes>& batch, std::size_t len1, double prefix_weight,
+                        double score_cutoff, double* scores)
+{
+    static_assert(Lanes % Match::width == 0, "the lanes have to fill whole registers");
+    std::size_t count = batch.count;
+    /* unused lanes of the last register are matched with a lane mask of 0 */
+    std::size_t lanes = ceil_div(count, Match::width) * Match::width;
+    std::array<uint64_t, Lanes> lane_mask;
+    std::array<double, Lanes> jaro_cutoff;
+    std::array<uint64_t, Lanes> P_flag;
+    std::array<uint64_t, Lanes> T_flag;
+    std::size_t active = 0;
+
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+        P_flag[lane] = 0;
+        T_flag[lane] = 0;
+        lane_mask[lane] = 0;
+        if (lane >= count) {
+            for (std::size_t i = 0; i < batch.max_len2; ++i) {
+                batch.window_match[i][lane] = 0;
+            }
+            continue;
+        }
+
+        std::size_t len2 = batch.len2[lane];
+        jaro_cutoff[lane] = jaro_winkler_jaro_cutoff(batch.prefix[lane], prefix_weight, score_cutoff);
+        bool possible = jaro_length_filter(len1, len2, jaro_cutoff[lane]);
+        lane_mask[lane] = possible ? ~UINT64_C(0) : 0;
+        active += possible;
+
+        /* positions behind the end of the choice do not match anything */
+        for (std::size_t i = len2; i < batch.max_len2; ++i) {
+            batch.window_match[i][lane] = 0;
+        }
+    }
+
+    for (std::size_t i = 0; i < batch.max_len2 && active; ++i) {
+        Match::match(batch.window_match[i].data(), lane_mask.data(), P_flag.data(), T_flag.data(), i, lanes);
+
+        /* remove lanes, that can not reach score_cutoff even when
+         * all remaining characters match
+         */
+        if ((i % 8) == 7) {
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                if (!lane_mask[lane] || jaro_cutoff[lane] <= 0) {
+                    continue;
+                }
+
+                std::size_t len2 = batch.len2[lane];
+                std::size_t remaining = (len2 > i + 1) ? len2 - i - 1 : 0;
+                std::size_t max_common = std::min(popcount64(T_flag[lane]) + remaining, std::min(len1, len2));
+                if (!max_common ||
+                    jaro_calculate_similarity(len1, len2, max_common, 0) < jaro_cutoff[lane])
+                {
+                    lane_mask[lane] = 0;
+                    --active;
+                }
+            }
+        }
+    }
+
+    for (std::size_t lane = 0; lane < count; ++lane) {
+        std::size_t common = popcount64(T_flag[lane]);
+        if (!lane_mask[lane] || !common) {
+            scores[lane] = 0.0;
+            continue;
+        }
+
+        std::size_t transpositions = 0;
+        uint64_t P_cur = P_flag[lane];
+        uint64_t T_cur = T_flag[lane];
+        while (T_cur) {
+            std::size_t i = countr_zero(T_cur);
+            if (!(batch.match[i][lane] & blsi(P_cur))) {
+                ++transpositions;
+            }
+            T_cur = blsr(T_cur);
+            P_cur = blsr(P_cur);
+        }
+
+        double sim = jaro_calculate_similarity(len1, batch.len2[lane], common, transpositions);
+        if (sim < jaro_cutoff[lane]) {
+            sim = 0.0;
+        }
+        scores[lane] = jaro_winkler_from_jaro(sim, batch.prefix[lane], prefix_weight, score_cutoff);
+    }
+}
+
+/* cached scorers used by process.extract/extractOne/extract_iter.
+ * The match vectors of s1 are only created once for all choices
+ */
+template <typename Sentence1>
+struct CachedJaroSimilarity {
+    Sentence1 s1;
+    BlockPatternMatchVector PM;
+
+    explicit CachedJaroSimilarity(const Sentence1& _s1) : s1(_s1), PM(_s1) {}
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        return jaro_bitparallel(PM, s1.size(), s2, score_cutoff);
+    }
+};
+
+template <typename Sentence1>
+struct CachedJaroWinklerSimilarity {
+    CachedJaroSimilarity<Sentence1> scorer;
+    double prefix_weight;
+
+    explicit CachedJaroWinklerSimilarity(const Sentence1& s1, double _prefix_weight = 0.1)
+      : scorer(s1), prefix_weight(_prefix_weight)
+    {
+        jaro_winkler_check_prefix_weight(prefix_weight);
+    }
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        std::size_t prefix = jaro_winkler_prefix(scorer.s1, s2);
+        double sim = scorer.ratio(s2, jaro_winkler_jaro_cutoff(prefix, prefix_weight, score_cutoff));
+        return jaro_winkler_from_jaro(sim, prefix, prefix_weight, score_cutoff);
+    }
+
+    /* batched scoring of short choices used by process.extract/extractOne */
+    typedef JaroBatch<jaro_batch_lanes> Batch;
+    static const std::size_t batch_size = jaro_batch_lanes;
+
+    bool batch_supported() const
+    {
+        return !scorer.s1.empty() && scorer.s1.size() <= 64;
+    }
+
+    /* returns false, when s2 is too long for the batch and has to be
+     * scored using ratio() instead
+     */
+    template <typename Sentence2>
+    bool batch_insert(Batch& batch, const Sentence2& s2) const
+    {
+        if (s2.size() > 64) {
+            return false;
+        }
+        batch.insert(scorer.PM, scorer.s1, s2);
+        return true;
+    }
+
+    void batch_ratio(Batch& batch, double score_cutoff, double* scores) const
+    {
+        jaro_winkler_batch(batch, scorer.s1.size(), prefix_weight, score_cutoff, scores);
+    }
+};
+
+} // namespace detail
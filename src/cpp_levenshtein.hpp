@@ -0,0 +1,727 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <rapidfuzz/string_metric.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace detail {
+
+/* vertical delta vectors of every column of the Levenshtein matrix.
+ * Column j stores D[i][j] - D[i-1][j] for all rows i, so the matrix only
+ * requires n * ceil(m / 64) * 2 words instead of n * m cells
+ */
+struct LevenshteinBitMatrix {
+    std::size_t rows;
+    std::size_t cols;
+    std::size_t words;
+    std::vector<uint64_t> VP;
+    std::vector<uint64_t> VN;
+
+    LevenshteinBitMatrix(std::size_t _rows, std::size_t _cols)
+      : rows(_rows), cols(_cols), words(ceil_div(_rows, 64)),
+        VP(_cols * words), VN(_cols * words) {}
+
+    /* D[i][j] - D[i-1][j] for i >= 1 */
+    int vertical_delta(std::size_t i, std::size_t j) const
+    {
+        /* first column: D[i][0] = i */
+        if (j == 0) {
+            return 1;
+        }
+
+        std::size_t pos = (j - 1) * words + (i - 1) / 64;
+        uint64_t bit = UINT64_C(1) << ((i - 1) % 64);
+        if (VP[pos] & bit) {
+            return 1;
+        }
+        if (VN[pos] & bit) {
+            return -1;
+        }
+        return 0;
+    }
+
+    /* D[i][j] reconstructed from the first row and the vertical deltas */
+    std::size_t value(std::size_t i, std::size_t j) const
+    {
+        if (j == 0) {
+            return i;
+        }
+
+        const uint64_t* vp = &VP[(j - 1) * words];
+        const uint64_t* vn = &VN[(j - 1) * words];
+        std::size_t pos = 0;
+        std::size_t neg = 0;
+        std::size_t full_words = i / 64;
+
+        for (std::size_t w = 0; w < full_words; ++w) {
+            pos += popcount64(vp[w]);
+            neg += popcount64(vn[w]);
+        }
+
+        if (i % 64) {
+            uint64_t mask = bit_mask_lsb(i % 64);
+            pos += popcount64(vp[full_words] & mask);
+            neg += popcount64(vn[full_words] & mask);
+        }
+
+        return j + pos - neg;
+    }
+};
+
+/* Myers' blockwise bit-parallel algorithm, which stores the vertical delta
+ * vectors of each column instead of only tracking the score of the last row
+ */
+template <typename Sentence1, typename Sentence2>
+LevenshteinBitMatrix levenshtein_matrix_bitparallel(const Sentence1& s1, const Sentence2& s2)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+    LevenshteinBitMatrix matrix(len1, len2);
+
+    if (!len1) {
+        return matrix;
+    }
+
+    BlockPatternMatchVector PM(s1);
+    std::size_t words = matrix.words;
+    std::vector<uint64_t> VP(words, ~UINT64_C(0));
+    std::vector<uint64_t> VN(words, 0);
+    const uint64_t high_bit = UINT64_C(1) << 63;
+
+    for (std::size_t j = 0; j < len2; ++j) {
+        /* D[0][j + 1] - D[0][j] = 1 */
+        int hin = 1;
+        uint64_t* vp_out = &matrix.VP[j * words];
+        uint64_t* vn_out = &matrix.VN[j * words];
+
+        for (std::size_t w = 0; w < words; ++w) {
+            uint64_t Eq = PM.get(w, s2[j]);
+            uint64_t Pv = VP[w];
+            uint64_t Mv = VN[w];
+
+            uint64_t Xv = Eq | Mv;
+            if (hin < 0) {
+                Eq |= 1;
+            }
+            uint64_t Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+            uint64_t Ph = Mv | ~(Xh | Pv);
+            uint64_t Mh = Pv & Xh;
+
+            int hout = 0;
+            if (Ph & high_bit) {
+                hout = 1;
+            } else if (Mh & high_bit) {
+                hout = -1;
+            }
+
+            Ph <<= 1;
+            Mh <<= 1;
+            if (hin < 0) {
+                Mh |= 1;
+            } else if (hin > 0) {
+                Ph |= 1;
+            }
+
+            Pv = Mh | ~(Xv | Ph);
+            Mv = Ph & Xv;
+
+            VP[w] = vp_out[w] = Pv;
+            VN[w] = vn_out[w] = Mv;
+            hin = hout;
+        }
+    }
+
+    return matrix;
+}
+
+/* last column of Myers' blockwise bit-parallel algorithm, which is advanced
+ * one character of s2 at a time. hin is the difference D[0][j + 1] - D[0][j]
+ * of the first row. score is the value of the last row
+ */
+struct MyersColumn {
+    std::vector<uint64_t> VP;
+    std::vector<uint64_t> VN;
+    uint64_t last_bit;
+    std::size_t score;
+
+    explicit MyersColumn(std::size_t len1)
+      : VP(ceil_div(len1, 64), ~UINT64_C(0)), VN(ceil_div(len1, 64), 0),
+        last_bit(UINT64_C(1) << ((len1 - 1) % 64)), score(len1) {}
+
+    template <typename CharT>
+    void advance(const BlockPatternMatchVector& PM, CharT ch, int hin)
+    {
+        const uint64_t high_bit = UINT64_C(1) << 63;
+        std::size_t words = VP.size();
+
+        for (std::size_t w = 0; w < words; ++w) {
+            uint64_t Eq = PM.get(w, ch);
+            uint64_t Pv = VP[w];
+            uint64_t Mv = VN[w];
+
+            uint64_t Xv = Eq | Mv;
+            if (hin < 0) {
+                Eq |= 1;
+            }
+            uint64_t Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+            uint64_t Ph = Mv | ~(Xh | Pv);
+            uint64_t Mh = Pv & Xh;
+
+            int hout = 0;
+            if (Ph & high_bit) {
+                hout = 1;
+            } else if (Mh & high_bit) {
+                hout = -1;
+            }
+
+            if (w == words - 1) {
+                if (Ph & last_bit) {
+                    ++score;
+                } else if (Mh & last_bit) {
+                    --score;
+                }
+            }
+
+            Ph <<= 1;
+            Mh <<= 1;
+            if (hin < 0) {
+                Mh |= 1;
+            } else if (hin > 0) {
+                Ph |= 1;
+            }
+
+            VP[w] = Mh | ~(Xv | Ph);
+            VN[w] = Ph & Xv;
+            hin = hout;
+        }
+    }
+};
+
+/* Sellers' approximate substring search using Myers' blockwise bit-parallel
+ * algorithm. The first row of the matrix is 0, so a match can start at any
+ * position of s2. Returns the minimum Levenshtein distance between s1 and a
+ * substring of s2 ending at position j for each position j of s2. s1 is not
+ * allowed to be empty.
+ */
+template <typename Sentence2>
+std::vector<std::size_t> levenshtein_search(const BlockPatternMatchVector& PM, std::size_t len1,
+                                            const Sentence2& s2)
+{
+    std::size_t len2 = s2.size();
+    std::vector<std::size_t> dist(len2);
+    MyersColumn column(len1);
+
+    for (std::size_t j = 0; j < len2; ++j) {
+        column.advance(PM, s2[j], 0);
+        dist[j] = column.score;
+    }
+
+    return dist;
+}
+
+struct LevenshteinMatch {
+    std::size_t start;
+    std::size_t end;
+    std::size_t distance;
+};
+
+/* start of the shortest substring s2[start:end] with a Levenshtein distance
+ * of dist to s1. The substring is searched backwards from end using the
+ * pattern match vector of the reversed s1
+ */
+template <typename Sentence2>
+std::size_t levenshtein_match_start(const BlockPatternMatchVector& PM_rev, std::size_t len1, const Sentence2& s2,
+                                    std::size_t end, std::size_t dist)
+{
+    MyersColumn column(len1);
+    std::size_t first = (end > len1 + dist) ? end - len1 - dist : 0;
+
+    for (std::size_t start = end; start > first; --start) {
+        column.advance(PM_rev, s2[start - 1], 1);
+        if (column.score == dist) {
+            return start - 1;
+        }
+    }
+
+    return first;
+}
+
+/* all approximate occurrences of s1 in s2 with a Levenshtein distance <= max.
+ * The text is scanned once using levenshtein_search and one match is reported
+ * for each local minimum of the distance. A plateau of the minimum reports a
+ * match every len(s1) positions, so repeated occurrences like "aa" in "aaaaaa"
+ * are all found. max is limited to len(s1) - 1, so every match contains at
+ * least one character of s1
+ */
+template <typename Sentence1, typename Sentence2>
+std::vector<LevenshteinMatch> levenshtein_find_all(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+    std::vector<LevenshteinMatch> matches;
+    if (!len1 || !len2) {
+        return matches;
+    }
+    max = std::min(max, len1 - 1);
+
+    BlockPatternMatchVector PM(s1);
+    std::vector<uint64_t> s1_rev(len1);
+    for (std::size_t i = 0; i < len1; ++i) {
+        s1_rev[i] = char_key(s1[len1 - 1 - i]);
+    }
+    BlockPatternMatchVector PM_rev(s1_rev);
+
+    /* candidate for the current local minimum */
+    bool found = false;
+    bool rising = false;
+    std::size_t best_end = 0;
+    std::size_t best_dist = 0;
+    auto report = [&]() {
+        std::size_t start = levenshtein_match_start(PM_rev, len1, s2, best_end, best_dist);
+        matches.push_back({start, best_end, best_dist});
+    };
+
+    MyersColumn column(len1);
+    for (std::size_t j = 0; j < len2; ++j) {
+        column.advance(PM, s2[j], 0);
+        std::size_t dist = column.score;
+
+        if (dist > max) {
+            if (found) {
+                report();
+            }
+            found = false;
+        } else if (!found || (rising && dist <= best_dist)) {
+            if (found) {
+                report();
+            }
+            found = true;
+            rising = false;
+            best_end = j + 1;
+            best_dist = dist;
+        } else if (dist < best_dist) {
+            best_end = j + 1;
+            best_dist = dist;
+        } else if (dist > best_dist) {
+            rising = true;
+        } else if (j + 1 >= best_end + len1) {
+            /* the next occurrence on a plateau does not overlap the candidate */
+            report();
+            best_end = j + 1;
+        }
+    }
+
+    if (found) {
+        report();
+    }
+    return matches;
+}
+
+/* Backtrack through the bit matrix. The operations are preferred in the
+ * order deletion, insertion, substitution, which matches the order used by
+ * the Wagner-Fischer based traceback, so the results do not change.
+ */
+template <typename Sentence1, typename Sentence2>
+std::vector<rapidfuzz::LevenshteinEditOp>
+levenshtein_editops_bitparallel(const Sentence1& s1, const Sentence2& s2, std::size_t prefix_len)
+{
+    LevenshteinBitMatrix matrix = levenshtein_matrix_bitparallel(s1, s2);
+    std::size_t row = s1.size();
+    std::size_t col = s2.size();
+    std::size_t dist = matrix.value(row, col);
+
+    std::vector<rapidfuzz::LevenshteinEditOp> editops(dist);
+    if (dist == 0) {
+        return editops;
+    }
+
+    std::size_t cur = dist;
+    /* D[row][col - 1] */
+    std::size_t left = col ? matrix.value(row, col - 1) : 0;
+
+    while (row || col) {
+        /* deletion */
+        if (row && matrix.vertical_delta(row, col) > 0) {
+            --dist;
+            editops[dist].type = rapidfuzz::LevenshteinEditType::Delete;
+            editops[dist].src_pos = row + prefix_len;
+            editops[dist].dest_pos = col + prefix_len;
+
+            if (col) {
+                left = static_cast<std::size_t>(
+                    static_cast<std::ptrdiff_t>(left) - matrix.vertical_delta(row, col - 1));
+            }
+            --row;
+            --cur;
+        }
+        /* insertion */
+        else if (col && left < cur) {
+            --dist;
+            editops[dist].type = rapidfuzz::LevenshteinEditType::Insert;
+            editops[dist].src_pos = row + prefix_len;
+            editops[dist].dest_pos = col + prefix_len;
+
+            --col;
+            cur = left;
+            left = col ? matrix.value(row, col - 1) : 0;
+        }
+        /* substitution / match */
+        else {
+            std::size_t diag = static_cast<std::size_t>(
+                static_cast<std::ptrdiff_t>(left) - matrix.vertical_delta(row, col - 1));
+
+            if (diag < cur) {
+                --dist;
+                editops[dist].type = rapidfuzz::LevenshteinEditType::Replace;
+                editops[dist].src_pos = row + prefix_len;
+                editops[dist].dest_pos = col + prefix_len;
+            }
+
+            --row;
+            --col;
+            cur = diag;
+            left = col ? matrix.value(row, col - 1) : 0;
+        }
+    }
+
+    return editops;
+}
+
+template <typename Sentence1, typename Sentence2>
+std::vector<rapidfuzz::LevenshteinEditOp> levenshtein_editops(const Sentence1& s1, const Sentence2& s2)
+{
+    /* prefix and suffix are no-ops, which do not need to be added to the editops */
+    Affix affix = common_affix(s1, s2);
+    std::size_t len1 = s1.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len2 = s2.size() - affix.prefix_len - affix.suffix_len;
+
+    return levenshtein_editops_bitparallel(
+        sub_sentence(s1, affix.prefix_len, len1),
+        sub_sentence(s2, affix.prefix_len, len2),
+        affix.prefix_len);
+}
+
+/* Diagonal transition algorithm by Ukkonen / Landau and Vishkin.
+ * For each diagonal k = j - i the furthest row reachable with d edits is
+ * tracked. Matching characters are skipped by sliding along the diagonal,
+ * so the runtime is O((N + M) * d) and only O(max) memory is required.
+ * Returns (std::size_t)-1 when the distance is larger than max.
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t levenshtein_diagonal(const Sentence1& s1, const Sentence2& s2, std::size_t max)
+{
+    std::ptrdiff_t len1 = static_cast<std::ptrdiff_t>(s1.size());
+    std::ptrdiff_t len2 = static_cast<std::ptrdiff_t>(s2.size());
+    std::size_t len_diff = static_cast<std::size_t>((len1 > len2) ? len1 - len2 : len2 - len1);
+
+    if (len_diff > max) {
+        return static_cast<std::size_t>(-1);
+    }
+
+    std::size_t max_dist = static_cast<std::size_t>(std::max(len1, len2));
+    if (max > max_dist) {
+        max = max_dist;
+    }
+
+    /* row of the furthest reaching point on each diagonal.
+     * diagonal k is stored at index k + offset
+     */
+    const std::ptrdiff_t unreachable = std::numeric_limits<std::ptrdiff_t>::min() / 2;
+    std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(max) + 1;
+    std::vector<std::ptrdiff_t> prev(2 * max + 3, unreachable);
+    std::vector<std::ptrdiff_t> cur(2 * max + 3, unreachable);
+    const std::ptrdiff_t target = len2 - len1;
+
+    for (std::size_t d = 0; d <= max; ++d) {
+        std::ptrdiff_t dist = static_cast<std::ptrdiff_t>(d);
+        std::ptrdiff_t k_min = std::max(-dist, -len1);
+        std::ptrdiff_t k_max = std::min(dist, len2);
+
+        for (std::ptrdiff_t k = k_min; k <= k_max; ++k) {
+            std::ptrdiff_t row;
+            if (d == 0) {
+                row = 0;
+            } else {
+                /* substitution / deletion / insertion */
+                row = std::max(std::max(prev[k + offset] + 1, prev[k + offset + 1] + 1),
+                               prev[k + offset - 1]);
+                row = std::min(row, std::min(len1, len2 - k));
+            }
+
+            if (row < 0 || row + k < 0) {
+                cur[k + offset] = unreachable;
+                continue;
+            }
+
+            while (row < len1 && row + k < len2 &&
+                   char_equal(s1[static_cast<std::size_t>(row)], s2[static_cast<std::size_t>(row + k)]))
+            {
+                ++row;
+            }
+
+            cur[k + offset] = row;
+            if (k == target && row >= len1) {
+                return d;
+            }
+        }
+
+        std::swap(prev, cur);
+    }
+
+    return static_cast<std::size_t>(-1);
+}
+
+/* state shared by the threads of levenshtein_blockwise_parallel.
+ * The blocks of s1 are split into horizontal stripes, which are processed by
+ * one thread each. A stripe depends on the horizontal deltas leaving the last
+ * row of the stripe above it, so the stripes are processed as a pipeline of
+ * tiles with `levenshtein_tile_cols` columns, which form anti-diagonals of the
+ * block matrix.
+ */
+static const std::size_t levenshtein_tile_cols = 1024;
+
+template <typename Sentence1, typename Sentence2>
+struct LevenshteinStripes {
+    const Sentence1& s1;
+    const Sentence2& s2;
+    BlockPatternMatchVector PM;
+    std::size_t stripe_count;
+    /* vertical delta vectors of the current column. Each stripe only accesses
+     * its own blocks, so they are allocated before starting the threads
+     */
+    std::vector<uint64_t> VP;
+    std::vector<uint64_t> VN;
+    /* horizontal delta leaving the bottom row of stripe i for each column */
+    std::vector<int8_t> carries;
+    /* amount of columns finished by each stripe */
+    std::unique_ptr<std::atomic<std::size_t>[]> progress;
+    std::size_t dist;
+
+    LevenshteinStripes(const Sentence1& _s1, const Sentence2& _s2, std::size_t _stripe_count)
+      : s1(_s1), s2(_s2), PM(_s1), stripe_count(_stripe_count),
+        VP(PM.size(), ~UINT64_C(0)), VN(PM.size(), 0),
+        carries((_stripe_count - 1) * _s2.size()),
+        progress(new std::atomic<std::size_t>[_stripe_count]), dist(_s1.size())
+    {
+        for (std::size_t i = 0; i < stripe_count; ++i) {
+            progress[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void run_stripe(std::size_t stripe)
+    {
+        std::size_t len1 = s1.size();
+        std::size_t len2 = s2.size();
+        std::size_t words = PM.size();
+        std::size_t first_word = stripe * words / stripe_count;
+        std::size_t last_word = (stripe + 1) * words / stripe_count;
+        std::size_t stripe_words = last_word - first_word;
+        bool is_last = (stripe + 1 == stripe_count);
+        const uint64_t last_bit = UINT64_C(1) << ((len1 - 1) % 64);
+
+        uint64_t* Pv_vec = &VP[first_word];
+        uint64_t* Mv_vec = &VN[first_word];
+        const int8_t* carry_in = stripe ? &carries[(stripe - 1) * len2] : nullptr;
+        int8_t* carry_out = is_last ? nullptr : &carries[stripe * len2];
+        std::size_t dist_delta_pos = 0;
+        std::size_t dist_delta_neg = 0;
+
+        for (std::size_t chunk_start = 0; chunk_start < len2; chunk_start += levenshtein_tile_cols) {
+            std::size_t chunk_end = std::min(chunk_start + levenshtein_tile_cols, len2);
+
+            /* wait until the stripe above finished the tile */
+            if (stripe) {
+                while (progress[stripe - 1].load(std::memory_order_acquire) < chunk_end) {
+                    std::this_thread::yield();
+                }
+            }
+
+            for (std::size_t j = chunk_start; j < chunk_end; ++j) {
+                /* D[0][j + 1] - D[0][j] = 1 */
+                int hin = stripe ? carry_in[j] : 1;
+                uint64_t HP_carry = (hin > 0);
+                uint64_t HN_carry = (hin < 0);
+
+                for (std::size_t w = 0; w < stripe_words; ++w) {
+                    uint64_t X = PM.get(first_word + w, s2[j]) | HN_carry;
+                    uint64_t Pv = Pv_vec[w];
+                    uint64_t Mv = Mv_vec[w];
+
+                    uint64_t D0 = (((X & Pv) + Pv) ^ Pv) | X | Mv;
+                    uint64_t HP = Mv | ~(D0 | Pv);
+                    uint64_t HN = D0 & Pv;
+
+                    uint64_t HP_carry_temp = HP_carry;
+                    uint64_t HN_carry_temp = HN_carry;
+                    if (w + 1 < stripe_words || !is_last) {
+                        HP_carry = HP >> 63;
+                        HN_carry = HN >> 63;
+                    } else {
+                        HP_carry = (HP & last_bit) != 0;
+                        HN_carry = (HN & last_bit) != 0;
+                    }
+
+                    HP = (HP << 1) | HP_carry_temp;
+                    HN = (HN << 1) | HN_carry_temp;
+
+                    Pv_vec[w] = HN | ~(D0 | HP);
+                    Mv_vec[w] = HP & D0;
+                }
+
+                if (is_last) {
+                    dist_delta_pos += static_cast<std::size_t>(HP_carry);
+                    dist_delta_neg += static_cast<std::size_t>(HN_carry);
+                } else {
+                    carry_out[j] = static_cast<int8_t>(static_cast<int>(HP_carry) - static_cast<int>(HN_carry));
+                }
+            }
+
+            progress[stripe].store(chunk_end, std::memory_order_release);
+        }
+
+        if (is_last) {
+            dist = dist + dist_delta_pos - dist_delta_neg;
+        }
+    }
+};
+
+/* Myers' blockwise algorithm distributed over up to `workers` threads.
+ * Every stripe receives exactly the same horizontal carries as in the serial
+ * implementation, so the result is identical to it.
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t levenshtein_blockwise_parallel(const Sentence1& s1, const Sentence2& s2, std::size_t workers)
+{
+    typedef LevenshteinStripes<Sentence1, Sentence2> Stripes;
+    Stripes stripes(s1, s2, workers);
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+
+    std::size_t started = 1;
+    try {
+        for (; started < workers; ++started) {
+            threads.emplace_back(&Stripes::run_stripe, &stripes, started);
+        }
+    } catch (const std::system_error&) {
+        /* the remaining stripes are processed by this thread below */
+    }
+
+    stripes.run_stripe(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t stripe = started; stripe < workers; ++stripe) {
+        stripes.run_stripe(stripe);
+    }
+
+    return stripes.dist;
+}
+
+/* amount of threads used by levenshtein_blockwise_parallel for the given
+ * strings. Each stripe should consist of enough blocks, so the work of a tile
+ * is large compared to the synchronisation between the threads.
+ * workers == 0 uses all available cores.
+ */
+static inline std::size_t levenshtein_parallel_stripes(std::size_t len1, std::size_t len2, std::size_t workers)
+{
+    const std::size_t min_stripe_words = 16;
+
+    if (workers == 0) {
+        workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    std::size_t words = ceil_div(len1, 64);
+    std::size_t max_stripes = words / min_stripe_words;
+    /* the pipeline only fills up with enough tiles per stripe */
+    if (len2 < 2 * levenshtein_tile_cols) {
+        return 1;
+    }
+
+    return std::max<std::size_t>(std::min(workers, max_stripes), 1);
+}
+
+/* uniform Levenshtein distance, which switches to the diagonal transition
+ * algorithm for long strings with a small distance. For them the runtime of
+ * O((N + M) * d) is a lot lower than the O([M/64]N) of the bit-parallel
+ * implementation.
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t uniform_levenshtein(const Sentence1& s1, const Sentence2& s2, std::size_t max,
+    std::size_t workers = 1)
+{
+    Affix affix = common_affix(s1, s2);
+    std::size_t len1 = s1.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t len2 = s2.size() - affix.prefix_len - affix.suffix_len;
+    std::size_t shorter = std::min(len1, len2);
+    std::size_t len_diff = std::max(len1, len2) - shorter;
+
+    if (len_diff > max) {
+        return static_cast<std::size_t>(-1);
+    }
+
+    auto sub1 = sub_sentence(s1, affix.prefix_len, len1);
+    auto sub2 = sub_sentence(s2, affix.prefix_len, len2);
+
+    /* the mbleven algorithm used for max <= 3 is already O(N) */
+    if (max > 3 && max < shorter / 64) {
+        return levenshtein_diagonal(sub1, sub2, max);
+    }
+
+    /* explore whether the strings are similar using a small bound, which costs
+     * at most an eighth of the bit-parallel implementation for dissimilar strings
+     */
+    std::size_t probe = shorter / 512;
+    if (probe > 3 && probe < max && len_diff <= probe) {
+        std::size_t dist = levenshtein_diagonal(sub1, sub2, probe);
+        if (dist != static_cast<std::size_t>(-1)) {
+            return dist;
+        }
+    }
+
+    /* the longer string is split into stripes, since it provides more blocks */
+    std::size_t dist;
+    if (len1 >= len2) {
+        std::size_t stripe_count = levenshtein_parallel_stripes(len1, len2, workers);
+        if (stripe_count < 2) {
+            return rapidfuzz::string_metric::levenshtein(s1, s2, {1, 1, 1}, max);
+        }
+        dist = levenshtein_blockwise_parallel(sub1, sub2, stripe_count);
+    } else {
+        std::size_t stripe_count = levenshtein_parallel_stripes(len2, len1, workers);
+        if (stripe_count < 2) {
+            return rapidfuzz::string_metric::levenshtein(s1, s2, {1, 1, 1}, max);
+        }
+        dist = levenshtein_blockwise_parallel(sub2, sub1, stripe_count);
+    }
+
+    return (dist <= max) ? dist : static_cast<std::size_t>(-1);
+}
+
+template <typename Sentence1, typename Sentence2>
+std::size_t levenshtein(const Sentence1& s1, const Sentence2& s2,
+    rapidfuzz::LevenshteinWeightTable weights, std::size_t max)
+{
+    if (weights.insert_cost == 1 && weights.delete_cost == 1 && weights.replace_cost == 1) {
+        return uniform_levenshtein(s1, s2, max);
+    }
+
+    return rapidfuzz::string_metric::levenshtein(s1, s2, weights, max);
+}
+
+/* uniform Levenshtein distance, which is allowed to use multiple threads for
+ * a single comparision of very long strings
+ */
+template <typename Sentence1, typename Sentence2>
+std::size_t levenshtein_parallel(const Sentence1& s1, const Sentence2& s2,
+    std::size_t max, std::size_t workers)
+{
+    return uniform_levenshtein(s1, s2, max, workers);
+}
+
+} // namespace detail
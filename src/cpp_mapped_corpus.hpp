@@ -0,0 +1,554 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace detail {
+
+/* Layout of a corpus file (version 1). All integers are stored in the byte
+ * order of the machine which wrote the file, which is recorded in the header:
+ *
+ *   MappedCorpusHeader
+ *   keys          MappedString[count]  strings compared with the query
+ *   choices       MappedString[count]  strings returned as results. Only present
+ *                                      with MAPPED_CORPUS_CHOICES, otherwise the
+ *                                      keys are returned
+ *   indices       uint64_t[count]      index of each string in the choices passed
+ *                                      to the writer, since None is skipped
+ *   length index  uint32_t[count]      positions of the keys sorted by their length.
+ *                                      Only present with MAPPED_CORPUS_LENGTH_INDEX
+ *   data                               code units of all strings, each string is
+ *                                      aligned to the size of its code units
+ *
+ * All offsets are in bytes from the start of the file, except for the offsets
+ * of the strings, which are relative to the data section.
+ */
+static const char mapped_corpus_magic[8] = {'R', 'F', 'C', 'O', 'R', 'P', 'U', 'S'};
+static const uint32_t mapped_corpus_version = 1;
+static const uint32_t mapped_corpus_byte_order = 0x01020304;
+
+enum MappedCorpusFlags {
+    MAPPED_CORPUS_CHOICES = 1,
+    MAPPED_CORPUS_LENGTH_INDEX = 2,
+    /* the keys were processed using utils.default_process */
+    MAPPED_CORPUS_DEFAULT_PROCESS = 4
+};
+
+struct MappedCorpusHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t keys_offset;
+    uint64_t choices_offset;
+    uint64_t indices_offset;
+    uint64_t length_index_offset;
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+struct MappedString {
+    uint64_t offset;
+    uint64_t length;
+    /* size of a code unit in bytes: 1, 2 or 4 */
+    uint32_t char_size;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(MappedCorpusHeader) == 80, "unexpected padding in MappedCorpusHeader");
+static_assert(sizeof(MappedString) == 24, "unexpected padding in MappedString");
+
+struct MappedStringView {
+    const void* data;
+    std::size_t length;
+    uint32_t char_size;
+};
+
+/* collects the strings of a corpus and writes them in the format above */
+class MappedCorpusWriter {
+public:
+    explicit MappedCorpusWriter(uint32_t flags = 0)
+      : m_flags(flags) {}
+
+    void add(const MappedStringView& key, const MappedStringView& choice, uint64_t index)
+    {
+        if (m_keys.size() >= UINT32_MAX) {
+            throw std::length_error("MappedCorpus supports at most 2^32 - 1 choices");
+        }
+        m_keys.push_back(append(key));
+        if (m_flags & MAPPED_CORPUS_CHOICES) {
+            m_choices.push_back(append(choice));
+        }
+        m_indices.push_back(index);
+    }
+
+    std::size_t size() const
+    {
+        return m_keys.size();
+    }
+
+    void write(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::ios_base::failure("could not open " + path + " for writing");
+        }
+        emit([&](const char* data, std::size_t size) {
+            file.write(data, static_cast<std::streamsize>(size));
+        });
+        file.close();
+        if (!file) {
+            throw std::ios_base::failure("could not write " + path);
+        }
+    }
+
+    /* contents of the corpus file in a single buffer */
+    std::vector<char> image() const
+    {
+        std::vector<char> buffer;
+        buffer.reserve(static_cast<std::size_t>(layout().data_offset + m_data.size()));
+        emit([&](const char* data, std::size_t size) {
+            buffer.insert(buffer.end(), data, data + size);
+        });
+        return buffer;
+    }
+
+private:
+    uint32_t m_flags;
+    std::vector<MappedString> m_keys;
+    std::vector<MappedString> m_choices;
+    std::vector<uint64_t> m_indices;
+    std::vector<char> m_data;
+
+    static uint64_t align(uint64_t offset, uint64_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    MappedString append(const MappedStringView& str)
+    {
+        MappedString entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.offset = align(m_data.size(), str.char_size);
+        entry.length = str.length;
+        entry.char_size = str.char_size;
+
+        const char* data = static_cast<const char*>(str.data);
+        m_data.resize(static_cast<std::size_t>(entry.offset));
+        m_data.insert(m_data.end(), data, data + str.length * str.char_size);
+        return entry;
+    }
+
+    /* header of the file with the offsets of all sections */
+    MappedCorpusHeader layout() const
+    {
+        const uint64_t count = m_keys.size();
+        MappedCorpusHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, mapped_corpus_magic, sizeof(header.magic));
+        header.version = mapped_corpus_version;
+        header.byte_order = mapped_corpus_byte_order;
+        header.flags = m_flags;
+        header.count = count;
+
+        uint64_t offset = sizeof(MappedCorpusHeader);
+        header.keys_offset = offset;
+        offset += count * sizeof(MappedString);
+        if (m_flags & MAPPED_CORPUS_CHOICES) {
+            header.choices_offset = offset;
+            offset += count * sizeof(MappedString);
+        }
+        header.indices_offset = offset;
+        offset += count * sizeof(uint64_t);
+        if (m_flags & MAPPED_CORPUS_LENGTH_INDEX) {
+            header.length_index_offset = offset;
+            offset += count * sizeof(uint32_t);
+        }
+        header.data_offset = align(offset, 8);
+        header.data_size = m_data.size();
+        return header;
+    }
+
+    /* passes the contents of the file in order to sink(data, size) */
+    template <typename Sink>
+    void emit(Sink sink) const
+    {
+        const MappedCorpusHeader header = layout();
+        sink(reinterpret_cast<const char*>(&header), sizeof(header));
+        emit_vector(sink, m_keys);
+        emit_vector(sink, m_choices);
+        emit_vector(sink, m_indices);
+
+        uint64_t end = header.indices_offset + m_indices.size() * sizeof(uint64_t);
+        if (m_flags & MAPPED_CORPUS_LENGTH_INDEX) {
+            std::vector<uint32_t> length_index(m_keys.size());
+            for (std::size_t i = 0; i < length_index.size(); ++i) {
+                length_index[i] = static_cast<uint32_t>(i);
+            }
+            std::stable_sort(length_index.begin(), length_index.end(), [this](uint32_t a, uint32_t b) {
+                return m_keys[a].length < m_keys[b].length;
+            });
+            emit_vector(sink, length_index);
+            end = header.length_index_offset + length_index.size() * sizeof(uint32_t);
+        }
+
+        static const char padding[8] = {};
+        sink(padding, static_cast<std::size_t>(header.data_offset - end));
+        emit_vector(sink, m_data);
+    }
+
+    template <typename Sink, typename T>
+    static void emit_vector(Sink& sink, const std::vector<T>& vec)
+    {
+        if (!vec.empty()) {
+            sink(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(T));
+        }
+    }
+};
+
+/* read only view of a corpus file, which is mapped into memory. Opening the
+ * file only validates the header, so it takes the same time for any size of
+ * the corpus. The pages are read by the operating system once they are
+ * accessed and are shared with all other processes mapping the same file.
+ * The strings are validated when they are accessed.
+ * A corpus can be loaded from a writer as well, which keeps the same layout
+ * in a single buffer. Searches only read the buffer, so its pages stay
+ * shared with the parent after a fork.
+ */
+class MappedCorpus {
+public:
+    MappedCorpus()
+      : m_base(nullptr), m_file_size(0), m_header(nullptr), m_keys(nullptr), m_choices(nullptr),
+        m_indices(nullptr), m_length_index(nullptr), m_data(nullptr)
+#ifdef _WIN32
+      , m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+#endif
+    {}
+
+    MappedCorpus(const MappedCorpus&) = delete;
+    MappedCorpus& operator=(const MappedCorpus&) = delete;
+
+    ~MappedCorpus()
+    {
+        close();
+    }
+
+    void open(const std::string& path)
+    {
+        close();
+        map(path);
+        try {
+            validate(path);
+        }
+        catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    /* uses the contents of a corpus file built by writer, which are stored
+     * in memory owned by the corpus instead of a mapping
+     */
+    void load(const MappedCorpusWriter& writer)
+    {
+        close();
+        m_image = writer.image();
+        m_base = m_image.data();
+        m_file_size = m_image.size();
+        try {
+            validate("<memory>");
+        }
+        catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    void close()
+    {
+        if (!m_image.empty()) {
+            std::vector<char>().swap(m_image);
+        }
+        else {
+            unmap();
+        }
+        m_base = nullptr;
+        m_file_size = 0;
+        m_header = nullptr;
+        m_keys = nullptr;
+        m_choices = nullptr;
+        m_indices = nullptr;
+        m_length_index = nullptr;
+        m_data = nullptr;
+    }
+
+    bool is_open() const
+    {
+        return m_base != nullptr;
+    }
+
+    std::size_t size() const
+    {
+        return m_header ? static_cast<std::size_t>(m_header->count) : 0;
+    }
+
+    uint32_t flags() const
+    {
+        return m_header ? m_header->flags : 0;
+    }
+
+    bool has_length_index() const
+    {
+        return m_length_index != nullptr;
+    }
+
+    MappedStringView key(std::size_t pos) const
+    {
+        return view(m_keys[pos]);
+    }
+
+    MappedStringView choice(std::size_t pos) const
+    {
+        return view(m_choices ? m_choices[pos] : m_keys[pos]);
+    }
+
+    /* length of a key, without accessing its code units */
+    std::size_t key_length(std::size_t pos) const
+    {
+        return static_cast<std::size_t>(m_keys[pos].length);
+    }
+
+    std::size_t index(std::size_t pos) const
+    {
+        return static_cast<std::size_t>(m_indices[pos]);
+    }
+
+    /* position of the n-th shortest key */
+    std::size_t by_length(std::size_t n) const
+    {
+        std::size_t pos = m_length_index[n];
+        if (pos >= size()) {
+            throw std::invalid_argument("corrupt corpus file: invalid length index");
+        }
+        return pos;
+    }
+
+    /* range [first, last) in the length index of the keys with
+     * min_len <= length <= max_len
+     */
+    void length_range(std::size_t min_len, std::size_t max_len, std::size_t& first, std::size_t& last) const
+    {
+        first = partition_point(min_len);
+        last = (max_len == SIZE_MAX) ? size() : partition_point(max_len + 1);
+        last = std::max(first, last);
+    }
+
+private:
+    const char* m_base;
+    std::size_t m_file_size;
+    const MappedCorpusHeader* m_header;
+    const MappedString* m_keys;
+    const MappedString* m_choices;
+    const uint64_t* m_indices;
+    const uint32_t* m_length_index;
+    const char* m_data;
+    /* contents of the corpus, when it is not mapped from a file */
+    std::vector<char> m_image;
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+
+    void unmap()
+    {
+#ifdef _WIN32
+        if (m_base) {
+            UnmapViewOfFile(m_base);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+        }
+        m_file = INVALID_HANDLE_VALUE;
+        m_mapping = nullptr;
+#else
+        if (m_base) {
+            munmap(const_cast<char*>(m_base), m_file_size);
+        }
+#endif
+    }
+
+    /* first position in the length index with a key length >= length */
+    std::size_t partition_point(std::size_t length) const
+    {
+        std::size_t first = 0;
+        std::size_t count = size();
+        while (count > 0) {
+            std::size_t step = count / 2;
+            if (key_length(by_length(first + step)) < length) {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else {
+                count = step;
+            }
+        }
+        return first;
+    }
+
+    MappedStringView view(const MappedString& str) const
+    {
+        const uint64_t data_size = m_header->data_size;
+        if ((str.char_size != 1 && str.char_size != 2 && str.char_size != 4) ||
+            str.offset % str.char_size != 0 || str.offset > data_size ||
+            str.length > (data_size - str.offset) / str.char_size)
+        {
+            throw std::invalid_argument("corrupt corpus file: invalid string");
+        }
+        return {m_data + str.offset, static_cast<std::size_t>(str.length), str.char_size};
+    }
+
+#ifdef _WIN32
+    static std::error_code last_error_code()
+    {
+        return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+#else
+    static std::error_code errno_code(int err)
+    {
+        return std::error_code(err, std::generic_category());
+    }
+#endif
+
+    void map(const std::string& path)
+    {
+#ifdef _WIN32
+        m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) {
+            throw std::ios_base::failure("could not open " + path, last_error_code());
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(m_file, &file_size)) {
+            std::error_code err = last_error_code();
+            close();
+            throw std::ios_base::failure("could not read the size of " + path, err);
+        }
+        m_file_size = static_cast<std::size_t>(file_size.QuadPart);
+        if (m_file_size < sizeof(MappedCorpusHeader)) {
+            close();
+            throw std::invalid_argument(path + " is not a corpus file");
+        }
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) {
+            std::error_code err = last_error_code();
+            close();
+            throw std::ios_base::failure("could not map " + path, err);
+        }
+        m_base = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_base) {
+            std::error_code err = last_error_code();
+            close();
+            throw std::ios_base::failure("could not map " + path, err);
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::ios_base::failure("could not open " + path, errno_code(errno));
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            int err = errno;
+            ::close(fd);
+            throw std::ios_base::failure("could not read the size of " + path, errno_code(err));
+        }
+        if (static_cast<uint64_t>(st.st_size) < sizeof(MappedCorpusHeader)) {
+            ::close(fd);
+            throw std::invalid_argument(path + " is not a corpus file");
+        }
+        m_file_size = static_cast<std::size_t>(st.st_size);
+        void* base = mmap(nullptr, m_file_size, PROT_READ, MAP_SHARED, fd, 0);
+        int err = errno;
+        /* the mapping keeps a reference to the file */
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            m_file_size = 0;
+            throw std::ios_base::failure("could not map " + path, errno_code(err));
+        }
+        m_base = static_cast<const char*>(base);
+#endif
+    }
+
+    /* checks that a table of count elements of size elem_size at offset is inside the file */
+    bool in_file(uint64_t offset, uint64_t count, uint64_t elem_size, uint64_t alignment) const
+    {
+        return offset % alignment == 0 && offset <= m_file_size &&
+               count <= (m_file_size - offset) / elem_size;
+    }
+
+    void validate(const std::string& path)
+    {
+        m_header = reinterpret_cast<const MappedCorpusHeader*>(m_base);
+        if (std::memcmp(m_header->magic, mapped_corpus_magic, sizeof(mapped_corpus_magic)) != 0) {
+            throw std::invalid_argument(path + " is not a corpus file");
+        }
+        if (m_header->byte_order != mapped_corpus_byte_order) {
+            throw std::invalid_argument(path + " was written on a machine with a different byte order");
+        }
+        if (m_header->version != mapped_corpus_version) {
+            throw std::invalid_argument(path + " uses the unsupported format version " +
+                                        std::to_string(m_header->version));
+        }
+
+        const uint64_t count = m_header->count;
+        const uint32_t flags = m_header->flags;
+        bool valid = count <= UINT32_MAX &&
+            in_file(m_header->keys_offset, count, sizeof(MappedString), 8) &&
+            in_file(m_header->indices_offset, count, sizeof(uint64_t), 8) &&
+            in_file(m_header->data_offset, m_header->data_size, 1, 8);
+        if (flags & MAPPED_CORPUS_CHOICES) {
+            valid = valid && in_file(m_header->choices_offset, count, sizeof(MappedString), 8);
+        }
+        if (flags & MAPPED_CORPUS_LENGTH_INDEX) {
+            valid = valid && in_file(m_header->length_index_offset, count, sizeof(uint32_t), 4);
+        }
+        if (!valid) {
+            throw std::invalid_argument("corrupt corpus file " + path);
+        }
+
+        m_keys = reinterpret_cast<const MappedString*>(m_base + m_header->keys_offset);
+        m_indices = reinterpret_cast<const uint64_t*>(m_base + m_header->indices_offset);
+        m_data = m_base + m_header->data_offset;
+        if (flags & MAPPED_CORPUS_CHOICES) {
+            m_choices = reinterpret_cast<const MappedString*>(m_base + m_header->choices_offset);
+        }
+        if (flags & MAPPED_CORPUS_LENGTH_INDEX) {
+            m_length_index = reinterpret_cast<const uint32_t*>(m_base + m_header->length_index_offset);
+        }
+    }
+};
+
+} // namespace detail
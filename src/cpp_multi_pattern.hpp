@@ -0,0 +1,228 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include "cpp_levenshtein.hpp"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace detail {
+
+struct PatternMatch {
+    std::size_t index;
+    std::size_t start;
+    std::size_t end;
+    std::size_t distance;
+    double score;
+};
+
+/* approximate search of many patterns in a text. Patterns with up to 64
+ * characters are packed next to each other into 64 bit words, so a single
+ * step of Myers' algorithm advances all patterns of a word at once:
+ * - the addition is performed without carrying into the next pattern
+ * - the bits shifted into the first row of a pattern are cleared, since
+ *   the first row of the search is 0
+ * The distance of a pattern is the sum of its vertical deltas, so it is only
+ * calculated when it can have dropped below the best distance found so far.
+ * Longer patterns are searched separately using the blockwise algorithm.
+ */
+class MultiPatternMatcher {
+public:
+    template <typename Sentence>
+    void add(const Sentence& pattern)
+    {
+        std::vector<uint64_t> keys(pattern.size());
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            keys[i] = char_key(pattern[i]);
+        }
+        m_patterns.push_back(std::move(keys));
+    }
+
+    std::size_t size() const
+    {
+        return m_patterns.size();
+    }
+
+    /* pack the patterns into words. Has to be called after adding the patterns */
+    void build()
+    {
+        m_words.clear();
+        m_slots.clear();
+        m_long_patterns.clear();
+        m_long_PM.clear();
+
+        std::size_t offset = 64;
+        for (std::size_t index = 0; index < m_patterns.size(); ++index) {
+            std::size_t len = m_patterns[index].size();
+            if (!len) {
+                continue;
+            }
+
+            if (len > 64) {
+                m_long_patterns.push_back(index);
+                m_long_PM.emplace_back(m_patterns[index]);
+                continue;
+            }
+
+            if (offset + len > 64) {
+                m_words.push_back({0, 0, m_slots.size(), m_slots.size()});
+                offset = 0;
+            }
+
+            PackedWord& word = m_words.back();
+            word.start_mask |= UINT64_C(1) << offset;
+            word.top_mask |= UINT64_C(1) << (offset + len - 1);
+            word.last_slot++;
+            m_slots.push_back({index, bit_mask_lsb(len) << offset, offset});
+            offset += len;
+        }
+
+        m_PM.init(m_words.size());
+        for (std::size_t w = 0; w < m_words.size(); ++w) {
+            for (std::size_t s = m_words[w].first_slot; s < m_words[w].last_slot; ++s) {
+                const std::vector<uint64_t>& pattern = m_patterns[m_slots[s].index];
+                for (std::size_t i = 0; i < pattern.size(); ++i) {
+                    m_PM.insert_mask(w, pattern[i], UINT64_C(1) << (m_slots[s].offset + i));
+                }
+            }
+        }
+    }
+
+    /* best occurrence of each pattern with a normalized score >= score_cutoff.
+     * The score is calculated like in normalized_find_all. The matches are
+     * sorted by score and index
+     */
+    template <typename Sentence>
+    std::vector<PatternMatch> match(const Sentence& text, double score_cutoff) const
+    {
+        const std::size_t none = static_cast<std::size_t>(-1);
+        std::size_t count = m_patterns.size();
+        std::vector<PatternMatch> matches;
+        if (score_cutoff > 100) {
+            return matches;
+        }
+
+        /* best_dist is initialized to max + 1, so only better matches are stored */
+        std::vector<std::size_t> best_dist(count);
+        std::vector<std::size_t> best_end(count, 0);
+        for (std::size_t index = 0; index < count; ++index) {
+            std::size_t len = m_patterns[index].size();
+            best_dist[index] = len ? std::min(score_cutoff_to_distance(score_cutoff, len), len - 1) + 1 : 0;
+        }
+
+        auto update = [&](std::size_t index, std::size_t dist, std::size_t j) {
+            if (dist < best_dist[index]) {
+                best_dist[index] = dist;
+                best_end[index] = j + 1;
+            }
+        };
+
+        std::size_t words = m_words.size();
+        std::vector<uint64_t> VP(words);
+        std::vector<uint64_t> VN(words, 0);
+        std::vector<std::size_t> word_next(words, 0);
+        std::vector<std::size_t> slot_next(m_slots.size(), 0);
+        for (std::size_t w = 0; w < words; ++w) {
+            for (std::size_t s = m_words[w].first_slot; s < m_words[w].last_slot; ++s) {
+                VP[w] |= m_slots[s].field_mask;
+            }
+        }
+
+        std::vector<MyersColumn> long_columns;
+        for (std::size_t index : m_long_patterns) {
+            long_columns.emplace_back(m_patterns[index].size());
+        }
+
+        for (std::size_t j = 0; j < text.size(); ++j) {
+            for (std::size_t w = 0; w < words; ++w) {
+                const PackedWord& word = m_words[w];
+                uint64_t Eq = m_PM.get(w, text[j]);
+                uint64_t Pv = VP[w];
+                uint64_t Mv = VN[w];
+
+                uint64_t Xv = Eq | Mv;
+                uint64_t X = Eq & Pv;
+                /* X + Pv without carrying from the top bit of a pattern into the next one */
+                uint64_t sum = ((X & ~word.top_mask) + (Pv & ~word.top_mask)) ^ ((X ^ Pv) & word.top_mask);
+                uint64_t Xh = (sum ^ Pv) | Eq;
+                uint64_t Ph = Mv | ~(Xh | Pv);
+                uint64_t Mh = Pv & Xh;
+
+                Ph = (Ph << 1) & ~word.start_mask;
+                Mh = (Mh << 1) & ~word.start_mask;
+
+                VP[w] = Mh | ~(Xv | Ph);
+                VN[w] = Ph & Xv;
+
+                if (word_next[w] > j) {
+                    continue;
+                }
+
+                /* the distance changes by at most 1 per character, so a pattern
+                 * with a distance of best_dist + k can only improve after k characters
+                 */
+                word_next[w] = none;
+                for (std::size_t s = word.first_slot; s < word.last_slot; ++s) {
+                    const PackedSlot& slot = m_slots[s];
+                    if (slot_next[s] <= j) {
+                        std::size_t dist = popcount64(VP[w] & slot.field_mask) - popcount64(VN[w] & slot.field_mask);
+                        update(slot.index, dist, j);
+
+                        std::size_t target = best_dist[slot.index];
+                        slot_next[s] = target ? j + 1 + dist - target : none;
+                    }
+                    word_next[w] = std::min(word_next[w], slot_next[s]);
+                }
+            }
+
+            for (std::size_t i = 0; i < long_columns.size(); ++i) {
+                long_columns[i].advance(m_long_PM[i], text[j], 0);
+                update(m_long_patterns[i], long_columns[i].score, j);
+            }
+        }
+
+        for (std::size_t index = 0; index < count; ++index) {
+            std::size_t len = m_patterns[index].size();
+            if (!best_end[index]) {
+                continue;
+            }
+
+            double score = norm_distance(best_dist[index], len, score_cutoff);
+            if (score == 0.0) {
+                continue;
+            }
+
+            std::vector<uint64_t> reversed(m_patterns[index].rbegin(), m_patterns[index].rend());
+            BlockPatternMatchVector PM_rev(reversed);
+            std::size_t start = levenshtein_match_start(PM_rev, len, text, best_end[index], best_dist[index]);
+            matches.push_back({index, start, best_end[index], best_dist[index], score});
+        }
+
+        std::sort(matches.begin(), matches.end(), [](const PatternMatch& a, const PatternMatch& b) {
+            return (a.score != b.score) ? a.score > b.score : a.index < b.index;
+        });
+        return matches;
+    }
+
+private:
+    struct PackedWord {
+        uint64_t start_mask;
+        uint64_t top_mask;
+        std::size_t first_slot;
+        std::size_t last_slot;
+    };
+
+    struct PackedSlot {
+        std::size_t index;
+        uint64_t field_mask;
+        std::size_t offset;
+    };
+
+    std::vector<std::vector<uint64_t>> m_patterns;
+    std::vector<PackedWord> m_words;
+    std::vector<PackedSlot> m_slots;
+    BlockPatternMatchVector m_PM;
+    std::vector<std::size_t> m_long_patterns;
+    std::vector<BlockPatternMatchVector> m_long_PM;
+};
+
+} // namespace detail
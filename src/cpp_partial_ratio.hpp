@@ -0,0 +1,291 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include "cpp_levenshtein.hpp"
+#include <rapidfuzz/fuzz.hpp>
+#include <rapidfuzz/types.hpp>
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace detail {
+
+struct MatchingBlock {
+    std::size_t spos;
+    std::size_t dpos;
+    std::size_t length;
+};
+
+/* same as difflib.SequenceMatcher(None, s1, s2, autojunk=False).get_matching_blocks().
+ * The longest match of each range is searched the same way as in difflib, so
+ * matches with the same length are resolved in the same order
+ */
+template <typename Sentence1, typename Sentence2>
+std::vector<MatchingBlock> get_matching_blocks(const Sentence1& s1, const Sentence2& s2)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+
+    std::unordered_map<uint64_t, std::vector<std::size_t>> b2j;
+    for (std::size_t j = 0; j < len2; ++j) {
+        b2j[char_key(s2[j])].push_back(j);
+    }
+
+    /* j2len[j + 1] is the length of the match ending at s2[j] in the previous row */
+    std::vector<std::size_t> j2len(len2 + 1, 0);
+    std::vector<std::size_t> new_j2len(len2 + 1, 0);
+    std::vector<std::size_t> touched;
+    std::vector<std::size_t> new_touched;
+
+    auto find_longest_match = [&](std::size_t alo, std::size_t ahi, std::size_t blo, std::size_t bhi) {
+        MatchingBlock best = {alo, blo, 0};
+
+        for (std::size_t i = alo; i < ahi; ++i) {
+            auto it = b2j.find(char_key(s1[i]));
+            if (it != b2j.end()) {
+                for (std::size_t j : it->second) {
+                    if (j < blo) {
+                        continue;
+                    }
+                    if (j >= bhi) {
+                        break;
+                    }
+
+                    std::size_t k = j2len[j] + 1;
+                    new_j2len[j + 1] = k;
+                    new_touched.push_back(j + 1);
+                    if (k > best.length) {
+                        best = {i + 1 - k, j + 1 - k, k};
+                    }
+                }
+            }
+
+            for (std::size_t idx : touched) {
+                j2len[idx] = 0;
+            }
+            std::swap(j2len, new_j2len);
+            std::swap(touched, new_touched);
+            new_touched.clear();
+        }
+
+        for (std::size_t idx : touched) {
+            j2len[idx] = 0;
+        }
+        touched.clear();
+        return best;
+    };
+
+    /* ranges (alo, ahi, blo, bhi), which are searched for matches */
+    std::vector<std::array<std::size_t, 4>> queue = {{{0, len1, 0, len2}}};
+    std::vector<MatchingBlock> blocks;
+    while (!queue.empty()) {
+        std::size_t alo = queue.back()[0];
+        std::size_t ahi = queue.back()[1];
+        std::size_t blo = queue.back()[2];
+        std::size_t bhi = queue.back()[3];
+        queue.pop_back();
+
+        MatchingBlock match = find_longest_match(alo, ahi, blo, bhi);
+        if (!match.length) {
+            continue;
+        }
+
+        blocks.push_back(match);
+        if (alo < match.spos && blo < match.dpos) {
+            queue.push_back({{alo, match.spos, blo, match.dpos}});
+        }
+        if (match.spos + match.length < ahi && match.dpos + match.length < bhi) {
+            queue.push_back({{match.spos + match.length, ahi, match.dpos + match.length, bhi}});
+        }
+    }
+
+    std::sort(blocks.begin(), blocks.end(), [](const MatchingBlock& a, const MatchingBlock& b) {
+        return (a.spos != b.spos) ? a.spos < b.spos : a.dpos < b.dpos;
+    });
+
+    /* merge adjacent blocks */
+    std::vector<MatchingBlock> merged;
+    for (const auto& block : blocks) {
+        if (!merged.empty() && merged.back().spos + merged.back().length == block.spos &&
+            merged.back().dpos + merged.back().length == block.dpos)
+        {
+            merged.back().length += block.length;
+        } else {
+            merged.push_back(block);
+        }
+    }
+
+    merged.push_back({len1, len2, 0});
+    return merged;
+}
+
+/* result of partial_ratio_alignment. s1[src_start:src_end] is the part of s1,
+ * which is compared to s2[dest_start:dest_end] to calculate the score
+ */
+struct ScoreAlignment {
+    double score;
+    std::size_t src_start;
+    std::size_t src_end;
+    std::size_t dest_start;
+    std::size_t dest_end;
+};
+
+/* partial_ratio aligns the shorter string s1 with a window of s2 for each
+ * matching block and returns the best ratio of these windows. Every window
+ * ending at position j of s2 has an InDel distance to s1, that is at least the
+ * minimum Levenshtein distance between s1 and a substring of s2 ending at j.
+ * These distances are calculated for all positions in a single pass using
+ * levenshtein_search, so ratio is only calculated for windows, which can
+ * still improve the result. Skipping the other windows does not change the result.
+ * Without a score_cutoff the bounds can only skip windows after a good window
+ * was found, which rarely pays for the additional pass, so all windows are
+ * scored. The window the score was found in is returned with the score, so
+ * callers do not need to search for it a second time.
+ */
+template <typename Sentence1, typename CachedRatio, typename Sentence2>
+ScoreAlignment partial_ratio_alignment_impl(const Sentence1& s1, const BlockPatternMatchVector& PM,
+                                            const CachedRatio& cached_ratio, const Sentence2& s2,
+                                            double score_cutoff)
+{
+    typedef typename Sentence2::value_type CharT2;
+    /* slack for rounding differences between the bound and the result of ratio */
+    const double epsilon = 1e-9;
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+    ScoreAlignment res = {0, 0, len1, 0, len1};
+
+    std::vector<std::size_t> dist;
+    if (score_cutoff > 0) {
+        dist = levenshtein_search(PM, len1, s2);
+        auto min_elem = std::min_element(dist.begin(), dist.end());
+
+        /* s1 is a substring of s2 */
+        if (!*min_elem) {
+            std::size_t end = static_cast<std::size_t>(min_elem - dist.begin()) + 1;
+            res.score = 100;
+            res.dest_start = end - len1;
+            res.dest_end = end;
+            return res;
+        }
+
+        /* the windows are at most len1 characters long */
+        if (norm_distance(*min_elem, 2 * len1, 0) + epsilon < score_cutoff) {
+            return res;
+        }
+    }
+
+    for (const auto& block : get_matching_blocks(s1, s2)) {
+        std::size_t long_start = (block.dpos > block.spos) ? block.dpos - block.spos : 0;
+        std::size_t window_len = std::min(len1, len2 - long_start);
+
+        if (!dist.empty()) {
+            double bound = norm_distance(dist[long_start + window_len - 1], len1 + window_len, 0);
+            if (bound + epsilon < score_cutoff) {
+                continue;
+            }
+        }
+
+        rapidfuzz::basic_string_view<CharT2> long_substr(s2.data() + long_start, window_len);
+        double ls_ratio = cached_ratio.ratio(long_substr, score_cutoff);
+        if (ls_ratio > res.score) {
+            score_cutoff = res.score = ls_ratio;
+            res.dest_start = long_start;
+            res.dest_end = long_start + window_len;
+            if (res.score == 100) {
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+template <typename Sentence1, typename CachedRatio, typename Sentence2>
+double partial_ratio_impl(const Sentence1& s1, const BlockPatternMatchVector& PM, const CachedRatio& cached_ratio,
+                          const Sentence2& s2, double score_cutoff)
+{
+    return partial_ratio_alignment_impl(s1, PM, cached_ratio, s2, score_cutoff).score;
+}
+
+template <typename Sentence1, typename Sentence2>
+ScoreAlignment partial_ratio_alignment(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    std::size_t len1 = s1.size();
+    std::size_t len2 = s2.size();
+
+    if (len1 > len2) {
+        ScoreAlignment res = partial_ratio_alignment(s2, s1, score_cutoff);
+        std::swap(res.src_start, res.dest_start);
+        std::swap(res.src_end, res.dest_end);
+        return res;
+    }
+
+    if (score_cutoff > 100) {
+        return {0, 0, len1, 0, len1};
+    }
+
+    if (!len1) {
+        return {static_cast<double>(!len2) * 100.0, 0, 0, 0, 0};
+    }
+
+    BlockPatternMatchVector PM(s1);
+    rapidfuzz::fuzz::CachedRatio<Sentence1> cached_ratio(s1);
+    return partial_ratio_alignment_impl(s1, PM, cached_ratio, s2, score_cutoff);
+}
+
+template <typename Sentence1, typename Sentence2>
+double partial_ratio(const Sentence1& s1, const Sentence2& s2, double score_cutoff)
+{
+    if (score_cutoff > 100) {
+        return 0;
+    }
+
+    if (!s1.size() || !s2.size()) {
+        return static_cast<double>(!s1.size() && !s2.size()) * 100.0;
+    }
+
+    if (s1.size() > s2.size()) {
+        return partial_ratio(s2, s1, score_cutoff);
+    }
+
+    BlockPatternMatchVector PM(s1);
+    rapidfuzz::fuzz::CachedRatio<Sentence1> cached_ratio(s1);
+    return partial_ratio_impl(s1, PM, cached_ratio, s2, score_cutoff);
+}
+
+/* cached scorer used by process.extract/extractOne/extract_iter */
+template <typename Sentence1>
+struct CachedPartialRatio {
+    Sentence1 s1;
+    BlockPatternMatchVector PM;
+    rapidfuzz::fuzz::CachedRatio<Sentence1> cached_ratio;
+
+    explicit CachedPartialRatio(const Sentence1& _s1) : s1(_s1), PM(_s1), cached_ratio(_s1) {}
+
+    template <typename Sentence2>
+    double ratio(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        /* the cached strings can only be used, when s1 is the shorter string */
+        if (score_cutoff > 100 || !s1.size() || s1.size() > s2.size()) {
+            return partial_ratio(s1, s2, score_cutoff);
+        }
+
+        return partial_ratio_impl(s1, PM, cached_ratio, s2, score_cutoff);
+    }
+
+    /* the window of s2 the score was found in, used by process.extract/extractOne
+     * with fuzz.partial_ratio_alignment
+     */
+    template <typename Sentence2>
+    ScoreAlignment alignment(const Sentence2& s2, double score_cutoff = 0) const
+    {
+        if (score_cutoff > 100 || !s1.size() || s1.size() > s2.size()) {
+            return partial_ratio_alignment(s1, s2, score_cutoff);
+        }
+
+        return partial_ratio_alignment_impl(s1, PM, cached_ratio, s2, score_cutoff);
+    }
+};
+
+} // namespace detail
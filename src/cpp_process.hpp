@@ -1,4 +1,9 @@
 #include "cpp_common.hpp"
+#include "cpp_fingerprint.hpp"
+#include "cpp_mapped_corpus.hpp"
+#include "cpp_multi_pattern.hpp"
+#include "cpp_token_corpus.hpp"
+#include <chrono>
 
 struct DictElem {
     PyObject* key;
@@ -60,25 +65,42 @@ struct ExtractDistanceComp
     }
 };
 
+/* monotonic clock used for the statistics of process.extract/extractOne/extract_iter */
+static inline int64_t monotonic_ns()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
 typedef double (*scorer_func) (void* context, const proc_string& str, double score_cutoff);
+typedef void (*scorer_batch_func) (void* context, const proc_string* strs, std::size_t count,
+                                   double score_cutoff, double* scores);
 typedef std::size_t (*distance_func) (void* context, const proc_string& str, std::size_t max);
+typedef void (*distance_batch_func) (void* context, const proc_string* strs, std::size_t count,
+                                     std::size_t max, std::size_t* distances);
 typedef void (*context_deinit) (void* context);
 
+/* scorers can optionally provide a batch_scorer, that scores up to batch_size
+ * choices at once. It is only used when batch_size is larger than 1
+ */
 struct CachedScorerContext {
     void* context;
     scorer_func scorer;
     context_deinit deinit;
+    scorer_batch_func batch_scorer;
+    std::size_t batch_size;
 
     CachedScorerContext()
-      : context(nullptr), scorer(nullptr), deinit(nullptr) {}
+      : context(nullptr), scorer(nullptr), deinit(nullptr), batch_scorer(nullptr), batch_size(0) {}
     CachedScorerContext(void* _context, scorer_func _scorer, context_deinit _deinit)
-      : context(_context), scorer(_scorer), deinit(_deinit) {}
+      : context(_context), scorer(_scorer), deinit(_deinit), batch_scorer(nullptr), batch_size(0) {}
 
     CachedScorerContext(const CachedScorerContext&) = delete;
     CachedScorerContext& operator=(const CachedScorerContext&) = delete;
 
     CachedScorerContext(CachedScorerContext&& other)
-     : context(other.context), scorer(other.scorer), deinit(other.deinit)
+     : context(other.context), scorer(other.scorer), deinit(other.deinit),
+       batch_scorer(other.batch_scorer), batch_size(other.batch_size)
     {
         other.context = nullptr;
     }
@@ -92,6 +114,8 @@ struct CachedScorerContext {
             context = other.context;
             scorer = other.scorer;
             deinit = other.deinit;
+            batch_scorer = other.batch_scorer;
+            batch_size = other.batch_size;
 
             other.context = nullptr;
       }
@@ -107,23 +131,30 @@ struct CachedScorerContext {
     double ratio(const proc_string& str, double score_cutoff) {
         return scorer(context, str, score_cutoff);
     }
+
+    void ratio_batch(const proc_string* strs, std::size_t count, double score_cutoff, double* scores) {
+        batch_scorer(context, strs, count, score_cutoff, scores);
+    }
 };
 
 struct CachedDistanceContext {
     void* context;
     distance_func scorer;
     context_deinit deinit;
+    distance_batch_func batch_scorer;
+    std::size_t batch_size;
 
     CachedDistanceContext()
-      : context(nullptr), scorer(nullptr), deinit(nullptr) {}
+      : context(nullptr), scorer(nullptr), deinit(nullptr), batch_scorer(nullptr), batch_size(0) {}
     CachedDistanceContext(void* _context, distance_func _scorer, context_deinit _deinit)
-      : context(_context), scorer(_scorer), deinit(_deinit) {}
+      : context(_context), scorer(_scorer), deinit(_deinit), batch_scorer(nullptr), batch_size(0) {}
 
     CachedDistanceContext(const CachedDistanceContext&) = delete;
     CachedDistanceContext& operator=(const CachedDistanceContext&) = delete;
 
     CachedDistanceContext(CachedDistanceContext&& other)
-     : context(other.context), scorer(other.scorer), deinit(other.deinit)
+     : context(other.context), scorer(other.scorer), deinit(other.deinit),
+       batch_scorer(other.batch_scorer), batch_size(other.batch_size)
     {
         other.context = nullptr;
     }
@@ -137,6 +168,8 @@ struct CachedDistanceContext {
             context = other.context;
             scorer = other.scorer;
             deinit = other.deinit;
+            batch_scorer = other.batch_scorer;
+            batch_size = other.batch_size;
 
             other.context = nullptr;
       }
@@ -152,6 +185,59 @@ struct CachedDistanceContext {
     std::size_t ratio(const proc_string& str, std::size_t max) {
         return scorer(context, str, max);
     }
+
+    void ratio_batch(const proc_string* strs, std::size_t count, std::size_t max, std::size_t* distances) {
+        batch_scorer(context, strs, count, max, distances);
+    }
+};
+
+typedef detail::ScoreAlignment (*alignment_func) (void* context, const proc_string& str, double score_cutoff);
+
+/* scorer returning the alignment of fuzz.partial_ratio_alignment, so
+ * process.extract/extractOne do not need to calculate it a second time
+ * for the results
+ */
+struct CachedAlignmentContext {
+    void* context;
+    alignment_func scorer;
+    context_deinit deinit;
+
+    CachedAlignmentContext()
+      : context(nullptr), scorer(nullptr), deinit(nullptr) {}
+
+    CachedAlignmentContext(const CachedAlignmentContext&) = delete;
+    CachedAlignmentContext& operator=(const CachedAlignmentContext&) = delete;
+
+    CachedAlignmentContext(CachedAlignmentContext&& other)
+     : context(other.context), scorer(other.scorer), deinit(other.deinit)
+    {
+        other.context = nullptr;
+    }
+
+    CachedAlignmentContext& operator=(CachedAlignmentContext&& other) {
+        if (&other != this) {
+            if (deinit && context) {
+                deinit(context);
+            }
+
+            context = other.context;
+            scorer = other.scorer;
+            deinit = other.deinit;
+
+            other.context = nullptr;
+      }
+      return *this;
+    };
+
+    ~CachedAlignmentContext() {
+        if (deinit && context) {
+            deinit(context);
+        }
+    }
+
+    detail::ScoreAlignment alignment(const proc_string& str, double score_cutoff) {
+        return scorer(context, str, score_cutoff);
+    }
 };
 
 template <typename CachedScorer>
@@ -189,6 +275,71 @@ static inline double cached_scorer_func(void* context, const proc_string& str, d
     }
 }
 
+/* scores up to CachedScorer::batch_size choices at once. Choices, that are not
+ * supported by the batch are scored one at a time
+ */
+template<typename CachedScorer>
+static inline void cached_scorer_batch_func_impl(void* context, const proc_string* strs, std::size_t count,
+    double score_cutoff, double* scores, int def_process)
+{
+    CachedScorer* scorer = (CachedScorer*)context;
+    typename CachedScorer::Batch batch;
+    std::size_t lane_index[CachedScorer::batch_size];
+    double lane_scores[CachedScorer::batch_size];
+
+    for (std::size_t i = 0; i < count; ++i) {
+        bool inserted = false;
+        switch(strs[i].kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND:                                        \
+            inserted = def_process                                                 \
+                ? scorer->batch_insert(batch, default_process<TYPE>(strs[i]))      \
+                : scorer->batch_insert(batch, no_process<TYPE>(strs[i]));          \
+            break;
+        LIST_OF_CASES()
+# undef X_ENUM
+        default:
+           throw std::logic_error("Reached end of control flow in cached_scorer_batch_func");
+        }
+
+        if (!inserted) {
+            scores[i] = def_process
+                ? cached_scorer_func_default_process<CachedScorer>(context, strs[i], score_cutoff)
+                : cached_scorer_func<CachedScorer>(context, strs[i], score_cutoff);
+            continue;
+        }
+
+        lane_index[batch.count - 1] = i;
+        if (batch.count == CachedScorer::batch_size) {
+            scorer->batch_ratio(batch, score_cutoff, lane_scores);
+            for (std::size_t lane = 0; lane < batch.count; ++lane) {
+                scores[lane_index[lane]] = lane_scores[lane];
+            }
+            batch.clear();
+        }
+    }
+
+    if (batch.count) {
+        scorer->batch_ratio(batch, score_cutoff, lane_scores);
+        for (std::size_t lane = 0; lane < batch.count; ++lane) {
+            scores[lane_index[lane]] = lane_scores[lane];
+        }
+    }
+}
+
+template<typename CachedScorer>
+static void cached_scorer_batch_func(void* context, const proc_string* strs, std::size_t count,
+    double score_cutoff, double* scores)
+{
+    cached_scorer_batch_func_impl<CachedScorer>(context, strs, count, score_cutoff, scores, 0);
+}
+
+template<typename CachedScorer>
+static void cached_scorer_batch_func_default_process(void* context, const proc_string* strs, std::size_t count,
+    double score_cutoff, double* scores)
+{
+    cached_scorer_batch_func_impl<CachedScorer>(context, strs, count, score_cutoff, scores, 1);
+}
+
 template<template <typename> class CachedScorer, typename CharT, typename ...Args>
 static inline CachedScorerContext get_CachedScorerContext(const proc_string& str, int def_process, Args... args)
 {
@@ -217,6 +368,36 @@ static inline CachedScorerContext cached_scorer_init(const proc_string& str, int
     }
 }
 
+template<template <typename> class CachedScorer, typename CharT, typename ...Args>
+static inline CachedScorerContext get_CachedBatchScorerContext(const proc_string& str, int def_process, Args... args)
+{
+    using Sentence = rapidfuzz::basic_string_view<CharT>;
+    CachedScorerContext context = get_CachedScorerContext<CachedScorer, CharT>(str, def_process, args...);
+
+    if (((CachedScorer<Sentence>*)context.context)->batch_supported()) {
+        if (def_process) {
+            context.batch_scorer = cached_scorer_batch_func_default_process<CachedScorer<Sentence>>;
+        } else {
+            context.batch_scorer = cached_scorer_batch_func<CachedScorer<Sentence>>;
+        }
+        context.batch_size = CachedScorer<Sentence>::batch_size;
+    }
+    return context;
+}
+
+/* same as cached_scorer_init for scorers, that provide a batched implementation */
+template<template <typename> class CachedScorer, typename ...Args>
+static inline CachedScorerContext cached_batch_scorer_init(const proc_string& str, int def_process, Args... args)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return get_CachedBatchScorerContext<CachedScorer, TYPE>(str, def_process, args...);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in cached_batch_scorer_init");
+    }
+}
+
 /* fuzz */
 static CachedScorerContext cached_ratio_init(const proc_string& str, int def_process)
 {
@@ -225,7 +406,64 @@ static CachedScorerContext cached_ratio_init(const proc_string& str, int def_pro
 
 static CachedScorerContext cached_partial_ratio_init(const proc_string& str, int def_process)
 {
-    return cached_scorer_init<fuzz::CachedPartialRatio>(str, def_process);
+    return cached_scorer_init<detail::CachedPartialRatio>(str, def_process);
+}
+
+template<typename CachedScorer>
+static inline detail::ScoreAlignment cached_alignment_func_default_process(
+    void* context, const proc_string& str, double score_cutoff)
+{
+    CachedScorer* scorer = (CachedScorer*)context;
+
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return scorer->alignment(default_process<TYPE>(str), score_cutoff);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in cached_alignment_func_default_process");
+    }
+}
+
+template<typename CachedScorer>
+static inline detail::ScoreAlignment cached_alignment_func(void* context, const proc_string& str, double score_cutoff)
+{
+    CachedScorer* scorer = (CachedScorer*)context;
+
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return scorer->alignment(no_process<TYPE>(str), score_cutoff);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in cached_alignment_func");
+    }
+}
+
+template<typename CharT>
+static inline CachedAlignmentContext get_CachedAlignmentContext(const proc_string& str, int def_process)
+{
+    using Sentence = rapidfuzz::basic_string_view<CharT>;
+    using CachedScorer = detail::CachedPartialRatio<Sentence>;
+    CachedAlignmentContext context;
+    context.context = (void*) new CachedScorer(Sentence((CharT*)str.data, str.length));
+
+    if (def_process) {
+        context.scorer = cached_alignment_func_default_process<CachedScorer>;
+    } else {
+        context.scorer = cached_alignment_func<CachedScorer>;
+    }
+    context.deinit = cached_deinit<CachedScorer>;
+    return context;
+}
+
+static CachedAlignmentContext cached_partial_ratio_alignment_init(const proc_string& str, int def_process)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return get_CachedAlignmentContext<TYPE>(str, def_process);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in cached_partial_ratio_alignment_init");
+    }
 }
 
 static CachedScorerContext cached_token_sort_ratio_init(const proc_string& str, int def_process)
@@ -280,17 +518,33 @@ static CachedScorerContext cached_normalized_levenshtein_init(const proc_string&
 
 static CachedScorerContext cached_normalized_hamming_init(const proc_string& str, int def_process)
 {
-    return cached_scorer_init<string_metric::CachedNormalizedHamming>(str, def_process);
+    return cached_batch_scorer_init<detail::CachedNormalizedHamming>(str, def_process);
 }
 
 static CachedScorerContext cached_jaro_winkler_similarity_init(const proc_string& str, int def_process, double prefix_weight)
 {
-    return cached_scorer_init<string_metric::CachedJaroWinklerSimilarity>(str, def_process, prefix_weight);
+    return cached_batch_scorer_init<detail::CachedJaroWinklerSimilarity>(str, def_process, prefix_weight);
 }
 
 static CachedScorerContext cached_jaro_similarity_init(const proc_string& str, int def_process)
 {
-    return cached_scorer_init<string_metric::CachedJaroSimilarity>(str, def_process);
+    return cached_scorer_init<detail::CachedJaroSimilarity>(str, def_process);
+}
+
+static CachedScorerContext cached_normalized_osa_init(const proc_string& str, int def_process)
+{
+    return cached_scorer_init<detail::CachedNormalizedOSA>(str, def_process);
+}
+
+static CachedScorerContext cached_normalized_damerau_levenshtein_init(const proc_string& str, int def_process)
+{
+    return cached_scorer_init<detail::CachedNormalizedDamerauLevenshtein>(str, def_process);
+}
+
+static CachedScorerContext cached_normalized_indel_init(const proc_string& str, int def_process)
+{
+    return cached_scorer_init<string_metric::CachedNormalizedLevenshtein>(
+        str, def_process, detail::indel_weights);
 }
 
 
@@ -355,6 +609,99 @@ static inline CachedDistanceContext cached_distance_init(const proc_string& str,
     }
 }
 
+/* distance version of cached_scorer_batch_func_impl */
+template<typename CachedDistance>
+static inline void cached_distance_batch_func_impl(void* context, const proc_string* strs, std::size_t count,
+    std::size_t max, std::size_t* distances, int def_process)
+{
+    CachedDistance* scorer = (CachedDistance*)context;
+    typename CachedDistance::Batch batch;
+    std::size_t lane_index[CachedDistance::batch_size];
+    std::size_t lane_distances[CachedDistance::batch_size];
+
+    for (std::size_t i = 0; i < count; ++i) {
+        bool inserted = false;
+        switch(strs[i].kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND:                                        \
+            inserted = def_process                                                 \
+                ? scorer->batch_insert(batch, default_process<TYPE>(strs[i]))      \
+                : scorer->batch_insert(batch, no_process<TYPE>(strs[i]));          \
+            break;
+        LIST_OF_CASES()
+# undef X_ENUM
+        default:
+           throw std::logic_error("Reached end of control flow in cached_distance_batch_func");
+        }
+
+        if (!inserted) {
+            distances[i] = def_process
+                ? cached_distance_func_default_process<CachedDistance>(context, strs[i], max)
+                : cached_distance_func<CachedDistance>(context, strs[i], max);
+            continue;
+        }
+
+        lane_index[batch.count - 1] = i;
+        if (batch.count == CachedDistance::batch_size) {
+            scorer->batch_distance(batch, max, lane_distances);
+            for (std::size_t lane = 0; lane < batch.count; ++lane) {
+                distances[lane_index[lane]] = lane_distances[lane];
+            }
+            batch.clear();
+        }
+    }
+
+    if (batch.count) {
+        scorer->batch_distance(batch, max, lane_distances);
+        for (std::size_t lane = 0; lane < batch.count; ++lane) {
+            distances[lane_index[lane]] = lane_distances[lane];
+        }
+    }
+}
+
+template<typename CachedDistance>
+static void cached_distance_batch_func(void* context, const proc_string* strs, std::size_t count,
+    std::size_t max, std::size_t* distances)
+{
+    cached_distance_batch_func_impl<CachedDistance>(context, strs, count, max, distances, 0);
+}
+
+template<typename CachedDistance>
+static void cached_distance_batch_func_default_process(void* context, const proc_string* strs, std::size_t count,
+    std::size_t max, std::size_t* distances)
+{
+    cached_distance_batch_func_impl<CachedDistance>(context, strs, count, max, distances, 1);
+}
+
+template<template <typename> class CachedDistance, typename CharT, typename ...Args>
+static inline CachedDistanceContext get_CachedBatchDistanceContext(const proc_string& str, int def_process, Args... args)
+{
+    using Sentence = rapidfuzz::basic_string_view<CharT>;
+    CachedDistanceContext context = get_CachedDistanceContext<CachedDistance, CharT>(str, def_process, args...);
+
+    if (((CachedDistance<Sentence>*)context.context)->batch_supported()) {
+        if (def_process) {
+            context.batch_scorer = cached_distance_batch_func_default_process<CachedDistance<Sentence>>;
+        } else {
+            context.batch_scorer = cached_distance_batch_func<CachedDistance<Sentence>>;
+        }
+        context.batch_size = CachedDistance<Sentence>::batch_size;
+    }
+    return context;
+}
+
+/* same as cached_distance_init for distances, that provide a batched implementation */
+template<template <typename> class CachedDistance, typename ...Args>
+static inline CachedDistanceContext cached_batch_distance_init(const proc_string& str, int def_process, Args... args)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return get_CachedBatchDistanceContext<CachedDistance, TYPE>(str, def_process, args...);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in cached_batch_distance_init");
+    }
+}
+
 /* string_metric */
 
 static CachedDistanceContext cached_levenshtein_init(const proc_string& str, int def_process,
@@ -367,5 +714,322 @@ static CachedDistanceContext cached_levenshtein_init(const proc_string& str, int
 
 static CachedDistanceContext cached_hamming_init(const proc_string& str, int def_process)
 {
-    return cached_distance_init<string_metric::CachedHamming>(str, def_process);
+    return cached_batch_distance_init<detail::CachedHamming>(str, def_process);
+}
+
+static CachedDistanceContext cached_osa_init(const proc_string& str, int def_process)
+{
+    return cached_distance_init<detail::CachedOSA>(str, def_process);
+}
+
+static CachedDistanceContext cached_damerau_levenshtein_init(const proc_string& str, int def_process)
+{
+    return cached_distance_init<detail::CachedDamerauLevenshtein>(str, def_process);
+}
+
+static CachedDistanceContext cached_indel_init(const proc_string& str, int def_process)
+{
+    return cached_distance_init<string_metric::CachedLevenshtein>(
+        str, def_process, detail::indel_weights);
+}
+
+
+/*************************************************
+ *               cached similarities
+ *************************************************/
+
+/* process handles similarities using the implementations for distances.
+ * The context returns SIZE_MAX - 1 - similarity, so a larger similarity is
+ * a smaller distance and a similarity below score_cutoff, which is returned
+ * as 0, is larger than max = SIZE_MAX - 1 - score_cutoff. SIZE_MAX is not
+ * used, since extractOne uses it for "no match found"
+ */
+template <typename Sentence1>
+struct CachedInvertedLCSseq {
+    detail::CachedLCSseq<Sentence1> scorer;
+
+    explicit CachedInvertedLCSseq(const Sentence1& s1) : scorer(s1) {}
+
+    template <typename Sentence2>
+    std::size_t distance(const Sentence2& s2, std::size_t max) const
+    {
+        std::size_t score_cutoff = (max < SIZE_MAX - 1) ? SIZE_MAX - 1 - max : 0;
+        return SIZE_MAX - 1 - scorer.similarity(s2, score_cutoff);
+    }
+};
+
+/* string_metric */
+
+static CachedDistanceContext cached_lcs_seq_init(const proc_string& str, int def_process)
+{
+    return cached_distance_init<CachedInvertedLCSseq>(str, def_process);
+}
+
+/* process.MultiPatternMatcher. The processor is applied in Python, since the
+ * positions of the matches have to refer to the text passed to match
+ */
+
+static void multi_pattern_add(detail::MultiPatternMatcher& matcher, const proc_string& str)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return matcher.add(no_process<TYPE>(str));
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in multi_pattern_add");
+    }
+}
+
+static std::vector<detail::PatternMatch> multi_pattern_match(
+    const detail::MultiPatternMatcher& matcher, const proc_string& str, double score_cutoff)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return matcher.match(no_process<TYPE>(str), score_cutoff);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in multi_pattern_match");
+    }
+}
+
+/* process.TokenCorpus */
+
+static void token_corpus_add(detail::TokenCorpus& corpus, const proc_string& str)
+{
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return corpus.add(no_process<TYPE>(str));
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in token_corpus_add");
+    }
+}
+
+static std::vector<detail::TokenMatch> token_corpus_extract(const detail::TokenCorpus& corpus,
+    const proc_string& str, int scorer, size_t limit, double score_cutoff, detail::TokenScorerStats& stats)
+{
+    detail::TokenScorer token_scorer = static_cast<detail::TokenScorer>(scorer);
+    switch(str.kind){
+# define X_ENUM(KIND, TYPE, ...) case KIND: return corpus.extract(no_process<TYPE>(str), token_scorer, limit, score_cutoff, stats);
+        LIST_OF_CASES()
+# undef X_ENUM
+    default:
+       throw std::logic_error("Reached end of control flow in token_corpus_extract");
+    }
+}
+
+/* process.MappedCorpus */
+
+static inline detail::MappedStringView mapped_string_view(const proc_string& str)
+{
+    switch(str.kind){
+    case RAPIDFUZZ_UINT8: return {str.data, str.length, 1};
+    case RAPIDFUZZ_UINT16: return {str.data, str.length, 2};
+    case RAPIDFUZZ_UINT32: return {str.data, str.length, 4};
+    default:
+       throw std::invalid_argument("MappedCorpus only supports strings");
+    }
+}
+
+static inline proc_string mapped_proc_string(const detail::MappedStringView& str)
+{
+    RapidfuzzType kind = (str.char_size == 1) ? RAPIDFUZZ_UINT8
+                       : (str.char_size == 2) ? RAPIDFUZZ_UINT16
+                       : RAPIDFUZZ_UINT32;
+    return proc_string(kind, false, const_cast<void*>(str.data), str.length);
+}
+
+static void mapped_corpus_add(detail::MappedCorpusWriter& writer, const proc_string& key,
+    const proc_string& choice, size_t index)
+{
+    writer.add(mapped_string_view(key), mapped_string_view(choice), index);
+}
+
+/* the size of a code unit is the kind of the Python string */
+static PyObject* mapped_corpus_choice(const detail::MappedCorpus& corpus, size_t pos)
+{
+    detail::MappedStringView str = corpus.choice(pos);
+    return PyUnicode_FromKindAndData(static_cast<int>(str.char_size), str.data,
+                                     static_cast<Py_ssize_t>(str.length));
+}
+
+template <typename T>
+struct MappedMatch {
+    T score;
+    size_t index;
+};
+
+/* the keys are scored in chunks, so scorers with a batched implementation
+ * can score multiple keys at once
+ */
+template <typename Context>
+static inline size_t mapped_chunk_size(const Context& context)
+{
+    return std::max<size_t>(context.batch_size, 1);
+}
+
+static inline void mapped_score_chunk(CachedScorerContext& context, const proc_string* strs, size_t count,
+    double score_cutoff, double* scores)
+{
+    if (context.batch_size > 1) {
+        context.ratio_batch(strs, count, score_cutoff, scores);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            scores[i] = context.ratio(strs[i], score_cutoff);
+        }
+    }
+}
+
+static inline void mapped_score_chunk(CachedDistanceContext& context, const proc_string* strs, size_t count,
+    size_t max, size_t* distances)
+{
+    if (context.batch_size > 1) {
+        context.ratio_batch(strs, count, max, distances);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            distances[i] = context.ratio(strs[i], max);
+        }
+    }
+}
+
+/* best `limit` keys with a length in [min_len, max_len], sorted by score and
+ * position. better(a, b) is true when the score a is better than b. Like in
+ * TokenCorpus the score of the worst result is used as cutoff once `limit`
+ * results are found. When the corpus has a length index and the lengths are
+ * bounded, only the keys in the bounds are visited, so their code units are
+ * never read from disk.
+ * The scan stops once all results have the score `optimal` and no key visited
+ * later can be placed before them, like in process.extractOne. Without the
+ * length index the keys are visited in order. With the index the keys of the
+ * length optimal_len are visited first, since only they can reach `optimal`,
+ * unless optimal_len is SIZE_MAX
+ */
+template <typename Score, typename Context, typename Better>
+static std::vector<MappedMatch<Score>> mapped_corpus_extract_impl(const detail::MappedCorpus& corpus,
+    Context& context, size_t limit, Score score_cutoff, Score optimal, size_t optimal_len,
+    size_t min_len, size_t max_len, Better better)
+{
+    auto comp = [&](const MappedMatch<Score>& a, const MappedMatch<Score>& b) {
+        return (a.score != b.score) ? better(a.score, b.score) : a.index < b.index;
+    };
+
+    std::vector<MappedMatch<Score>> matches;
+    if (!limit || min_len > max_len) {
+        return matches;
+    }
+
+    bool bounded = min_len > 0 || max_len != SIZE_MAX;
+    size_t first = 0;
+    size_t last = corpus.size();
+    bool use_index = bounded && corpus.has_length_index();
+    if (use_index) {
+        corpus.length_range(min_len, max_len, first, last);
+    }
+    bool can_stop = !use_index;
+
+    const size_t chunk_size = mapped_chunk_size(context);
+    std::vector<proc_string> strs;
+    std::vector<size_t> positions;
+    std::vector<Score> scores(chunk_size);
+    strs.reserve(chunk_size);
+    positions.reserve(chunk_size);
+
+    std::priority_queue<MappedMatch<Score>, std::vector<MappedMatch<Score>>, decltype(comp)> heap(comp);
+    auto optimal_found = [&]() {
+        return heap.size() == limit && heap.top().score == optimal;
+    };
+
+    auto flush = [&]() {
+        mapped_score_chunk(context, strs.data(), strs.size(), score_cutoff, scores.data());
+        for (size_t i = 0; i < strs.size(); ++i) {
+            if (better(score_cutoff, scores[i])) {
+                continue;
+            }
+
+            heap.push({scores[i], positions[i]});
+            if (heap.size() > limit) {
+                heap.pop();
+            }
+            if (heap.size() == limit && better(heap.top().score, score_cutoff)) {
+                score_cutoff = heap.top().score;
+            }
+        }
+        strs.clear();
+        positions.clear();
+        return can_stop && optimal_found();
+    };
+
+    /* visits [begin, end) of the corpus or of the length index and returns
+     * true when the scan can stop
+     */
+    auto scan = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            size_t pos = use_index ? corpus.by_length(i) : i;
+            if (bounded && !use_index) {
+                size_t length = corpus.key_length(pos);
+                if (length < min_len || length > max_len) {
+                    continue;
+                }
+            }
+
+            strs.push_back(mapped_proc_string(corpus.key(pos)));
+            positions.push_back(pos);
+            if (strs.size() == chunk_size && flush()) {
+                return true;
+            }
+        }
+        return !strs.empty() && flush();
+    };
+
+    if (use_index && optimal_len != SIZE_MAX) {
+        size_t optimal_first, optimal_last;
+        corpus.length_range(optimal_len, optimal_len, optimal_first, optimal_last);
+        optimal_first = std::min(std::max(optimal_first, first), last);
+        optimal_last = std::min(std::max(optimal_last, optimal_first), last);
+
+        scan(optimal_first, optimal_last);
+        can_stop = true;
+        if (!optimal_found() && !scan(first, optimal_first)) {
+            scan(optimal_last, last);
+        }
+    } else {
+        scan(first, last);
+    }
+
+    while (!heap.empty()) {
+        matches.push_back(heap.top());
+        heap.pop();
+    }
+    std::reverse(matches.begin(), matches.end());
+    return matches;
+}
+
+/* the length is only bounded for scorers, which require a key with the
+ * length of the query for the optimal score
+ */
+static std::vector<MappedMatch<double>> mapped_corpus_extract(const detail::MappedCorpus& corpus,
+    CachedScorerContext& context, size_t limit, double score_cutoff, size_t query_len,
+    size_t min_len, size_t max_len)
+{
+    return mapped_corpus_extract_impl(corpus, context, limit, score_cutoff, 100.0, query_len,
+        min_len, max_len, [](double a, double b) { return a > b; });
+}
+
+static std::vector<MappedMatch<size_t>> mapped_corpus_extract_distance(const detail::MappedCorpus& corpus,
+    CachedDistanceContext& context, size_t limit, size_t max, size_t query_len,
+    size_t min_len, size_t max_len)
+{
+    return mapped_corpus_extract_impl(corpus, context, limit, max, size_t(0), query_len,
+        min_len, max_len, [](size_t a, size_t b) { return a < b; });
+}
+
+/* similarity using the inverted scores of cached_lcs_seq_init. The
+ * similarity is at most the length of the query
+ */
+static std::vector<MappedMatch<size_t>> mapped_corpus_extract_similarity(const detail::MappedCorpus& corpus,
+    CachedDistanceContext& context, size_t limit, size_t max, size_t query_len,
+    size_t min_len, size_t max_len)
+{
+    return mapped_corpus_extract_impl(corpus, context, limit, max, SIZE_MAX - 1 - query_len, SIZE_MAX,
+        min_len, max_len, [](size_t a, size_t b) { return a < b; });
 }
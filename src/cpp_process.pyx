@@ -11,11 +11,20 @@ from rapidfuzz.string_metric import (
     normalized_hamming,
     jaro_similarity,
     jaro_winkler_similarity,
+    osa,
+    normalized_osa,
+    damerau_levenshtein,
+    normalized_damerau_levenshtein,
+    indel,
+    normalized_indel,
+    lcs_seq,
 )
 
 from rapidfuzz.fuzz import (
     ratio,
     partial_ratio,
+    partial_ratio_alignment,
+    ScoreAlignment,
     token_sort_ratio,
     token_set_ratio,
     token_ratio,
@@ -27,8 +36,10 @@ from rapidfuzz.fuzz import (
 )
 
 from libcpp.vector cimport vector
+from libcpp.string cimport string
 from libcpp cimport algorithm
 from libcpp.utility cimport move
+from libc.stdint cimport uint32_t, uint64_t, int64_t
 
 from cpython.list cimport PyList_New, PyList_SET_ITEM
 from cpython.object cimport PyObject
@@ -37,6 +48,7 @@ from cpython.ref cimport Py_INCREF, Py_DECREF
 from cpp_common cimport proc_string, is_valid_string, convert_string, hash_array, hash_sequence
 
 import heapq
+import os
 from array import array
 
 
@@ -52,10 +64,14 @@ cdef extern from "cpp_process.hpp":
     cdef cppclass CachedScorerContext:
         CachedScorerContext()
         double ratio(const proc_string&, double) except +
+        void ratio_batch(const proc_string*, size_t, double, double*) except +
+        size_t batch_size
 
     cdef cppclass CachedDistanceContext:
         CachedDistanceContext()
         size_t ratio(const proc_string&, size_t) except +
+        void ratio_batch(const proc_string*, size_t, size_t, size_t*) except +
+        size_t batch_size
 
     # normalized distances
     # fuzz
@@ -74,10 +90,34 @@ cdef extern from "cpp_process.hpp":
     CachedScorerContext cached_normalized_hamming_init(      const proc_string&, int) except +
     CachedScorerContext cached_jaro_winkler_similarity_init( const proc_string&, int, double) except +
     CachedScorerContext cached_jaro_similarity_init(         const proc_string&, int) except +
+    CachedScorerContext cached_normalized_osa_init(          const proc_string&, int) except +
+    CachedScorerContext cached_normalized_damerau_levenshtein_init(const proc_string&, int) except +
+    CachedScorerContext cached_normalized_indel_init(        const proc_string&, int) except +
 
     # distances
     CachedDistanceContext cached_levenshtein_init(const proc_string&, int, size_t, size_t, size_t) except +
     CachedDistanceContext cached_hamming_init(    const proc_string&, int) except +
+    CachedDistanceContext cached_osa_init(        const proc_string&, int) except +
+    CachedDistanceContext cached_damerau_levenshtein_init(const proc_string&, int) except +
+    CachedDistanceContext cached_indel_init(      const proc_string&, int) except +
+
+    # similarities, which return <size_t>-2 - similarity
+    CachedDistanceContext cached_lcs_seq_init(const proc_string&, int) except +
+
+    ctypedef struct CppScoreAlignment "detail::ScoreAlignment":
+        double score
+        size_t src_start
+        size_t src_end
+        size_t dest_start
+        size_t dest_end
+
+    cdef cppclass CachedAlignmentContext:
+        CachedAlignmentContext()
+        CppScoreAlignment alignment(const proc_string&, double) except +
+
+    CachedAlignmentContext cached_partial_ratio_alignment_init(const proc_string&, int) except +
+
+    int64_t monotonic_ns() nogil
 
 
     ctypedef struct ExtractScorerComp:
@@ -108,6 +148,115 @@ cdef extern from "cpp_process.hpp":
         PyObject* choice
         PyObject* key
 
+cdef extern from "cpp_trace.hpp":
+    cdef enum TraceFunction:
+        TRACE_EXTRACT_ONE
+        TRACE_EXTRACT
+
+    void trace_extract_start(int, object)
+    void trace_extract_end(int, size_t) nogil
+    void trace_batch_start(size_t) nogil
+    void trace_batch_end(size_t) nogil
+    void trace_scorer_init_start(size_t) nogil
+    void trace_scorer_init_end() nogil
+    void trace_sort_start(size_t) nogil
+    void trace_sort_end(size_t) nogil
+
+cdef extern from "cpp_fingerprint.hpp" namespace "detail":
+    ctypedef struct FingerprintMatch:
+        size_t distance
+        size_t index
+
+    cdef cppclass CppFingerprintCorpus "detail::FingerprintCorpus":
+        CppFingerprintCorpus(size_t) except +
+        size_t bits()
+        size_t size()
+        const uint64_t* get(size_t)
+        void add(const uint64_t*) except +
+        vector[FingerprintMatch] extract(const uint64_t*, size_t, size_t, size_t) nogil except +
+        vector[FingerprintMatch] extract_radius(const uint64_t*, size_t, size_t) nogil except +
+        void build_index(size_t) except +
+        size_t index_substrings()
+
+cdef extern from "cpp_multi_pattern.hpp" namespace "detail":
+    ctypedef struct PatternMatch:
+        size_t index
+        size_t start
+        size_t end
+        size_t distance
+        double score
+
+    cdef cppclass CppMultiPatternMatcher "detail::MultiPatternMatcher":
+        size_t size()
+        void build() except +
+
+cdef extern from "cpp_process.hpp":
+    void multi_pattern_add(CppMultiPatternMatcher&, const proc_string&) except +
+    vector[PatternMatch] multi_pattern_match(const CppMultiPatternMatcher&, const proc_string&, double) nogil except +
+
+cdef extern from "cpp_token_corpus.hpp" namespace "detail":
+    ctypedef struct TokenMatch:
+        size_t index
+        double score
+
+    cdef enum TokenScorer:
+        TOKEN_SORT_RATIO
+        TOKEN_SET_RATIO
+        TOKEN_RATIO
+        PARTIAL_TOKEN_SORT_RATIO
+        PARTIAL_TOKEN_SET_RATIO
+        PARTIAL_TOKEN_RATIO
+        TOKEN_WRATIO
+
+    cdef cppclass TokenScorerStats:
+        size_t wratio_calls
+        size_t ratio_skipped
+        size_t partial_ratio_skipped
+        size_t token_ratio_skipped
+        size_t token_sort_skipped
+        size_t token_set_skipped
+
+    cdef cppclass CppTokenCorpus "detail::TokenCorpus":
+        size_t size()
+        size_t token_count()
+        void build() except +
+
+cdef extern from "cpp_process.hpp":
+    void token_corpus_add(CppTokenCorpus&, const proc_string&) except +
+    vector[TokenMatch] token_corpus_extract(const CppTokenCorpus&, const proc_string&, int, size_t, double, TokenScorerStats&) nogil except +
+
+cdef extern from "cpp_mapped_corpus.hpp" namespace "detail":
+    cdef enum MappedCorpusFlags:
+        MAPPED_CORPUS_CHOICES
+        MAPPED_CORPUS_LENGTH_INDEX
+        MAPPED_CORPUS_DEFAULT_PROCESS
+
+    cdef cppclass CppMappedCorpusWriter "detail::MappedCorpusWriter":
+        CppMappedCorpusWriter(uint32_t) except +
+        size_t size()
+        void write(const string&) except +
+
+    cdef cppclass CppMappedCorpus "detail::MappedCorpus":
+        void open(const string&) except +
+        void load(const CppMappedCorpusWriter&) except +
+        void close()
+        bint is_open()
+        size_t size()
+        uint32_t flags()
+        bint has_length_index()
+        size_t index(size_t)
+
+cdef extern from "cpp_process.hpp":
+    cdef cppclass MappedMatch[T]:
+        T score
+        size_t index
+
+    void mapped_corpus_add(CppMappedCorpusWriter&, const proc_string&, const proc_string&, size_t) except +
+    object mapped_corpus_choice(const CppMappedCorpus&, size_t) except +
+    vector[MappedMatch[double]] mapped_corpus_extract(const CppMappedCorpus&, CachedScorerContext&, size_t, double, size_t, size_t, size_t) nogil except +
+    vector[MappedMatch[size_t]] mapped_corpus_extract_distance(const CppMappedCorpus&, CachedDistanceContext&, size_t, size_t, size_t, size_t, size_t) nogil except +
+    vector[MappedMatch[size_t]] mapped_corpus_extract_similarity(const CppMappedCorpus&, CachedDistanceContext&, size_t, size_t, size_t, size_t, size_t) nogil except +
+
 
 cdef inline CachedScorerContext CachedNormalizedLevenshteinInit(const proc_string& query, int def_process, dict kwargs):
     cdef size_t insertion, deletion, substitution
@@ -139,17 +288,29 @@ cdef inline int IsIntegratedScorer(object scorer):
         scorer is normalized_levenshtein or
         scorer is normalized_hamming or
         scorer is jaro_similarity or
-        scorer is jaro_winkler_similarity
+        scorer is jaro_winkler_similarity or
+        scorer is normalized_osa or
+        scorer is normalized_damerau_levenshtein or
+        scorer is normalized_indel
     )
 
 cdef inline int IsIntegratedDistance(object scorer):
     return (
         scorer is levenshtein or
-        scorer is hamming
+        scorer is hamming or
+        scorer is osa or
+        scorer is damerau_levenshtein or
+        scorer is indel
+    )
+
+cdef inline int IsIntegratedSimilarity(object scorer):
+    return (
+        scorer is lcs_seq
     )
 
 cdef inline CachedScorerContext CachedScorerInit(object scorer, const proc_string& query, int def_process, dict kwargs):
     cdef CachedScorerContext context
+    trace_scorer_init_start(query.length)
 
     if scorer is ratio:
         context = cached_ratio_init(query, def_process)
@@ -179,19 +340,57 @@ cdef inline CachedScorerContext CachedScorerInit(object scorer, const proc_strin
         context = cached_jaro_similarity_init(query, def_process)
     elif scorer is jaro_winkler_similarity:
         context = CachedJaroWinklerSimilarityInit(query, def_process, kwargs)
-
+    elif scorer is normalized_osa:
+        context = cached_normalized_osa_init(query, def_process)
+    elif scorer is normalized_damerau_levenshtein:
+        context = cached_normalized_damerau_levenshtein_init(query, def_process)
+    elif scorer is normalized_indel:
+        context = cached_normalized_indel_init(query, def_process)
+
+    trace_scorer_init_end()
     return move(context)
 
 cdef inline CachedDistanceContext CachedDistanceInit(object scorer, const proc_string& query, int def_process, dict kwargs):
     cdef CachedDistanceContext context
+    trace_scorer_init_start(query.length)
 
     if scorer is levenshtein:
         context = CachedLevenshteinInit(query, def_process, kwargs)
     elif scorer is hamming:
         context = cached_hamming_init(query, def_process)
+    elif scorer is osa:
+        context = cached_osa_init(query, def_process)
+    elif scorer is damerau_levenshtein:
+        context = cached_damerau_levenshtein_init(query, def_process)
+    elif scorer is indel:
+        context = cached_indel_init(query, def_process)
+
+    trace_scorer_init_end()
+    return move(context)
+
+cdef inline CachedDistanceContext CachedSimilarityInit(object scorer, const proc_string& query, int def_process, dict kwargs):
+    """
+    similarities are handled by the implementations for distances. The
+    context returns `<size_t>-2 - similarity`, so the best match has the
+    smallest value. Use similarity_to_max and similarity_result to convert
+    the score_cutoff and the results
+    """
+    cdef CachedDistanceContext context
+    trace_scorer_init_start(query.length)
 
+    if scorer is lcs_seq:
+        context = cached_lcs_seq_init(query, def_process)
+
+    trace_scorer_init_end()
     return move(context)
 
+cdef inline size_t similarity_to_max(size_t min_similarity):
+    return <size_t>-2 - min_similarity
+
+cdef inline tuple similarity_result(tuple result):
+    choice, distance, key = result
+    return (choice, <size_t>-2 - <size_t>distance, key)
+
 
 cdef inline extractOne_dict(CachedScorerContext context, choices, processor, double score_cutoff):
     """
@@ -205,6 +404,7 @@ cdef inline extractOne_dict(CachedScorerContext context, choices, processor, dou
     result_choice = None
     result_key = None
 
+    trace_extract_start(TRACE_EXTRACT_ONE, choices)
     if processor is not None:
         for choice_key, choice in choices.items():
             if choice is None:
@@ -238,6 +438,7 @@ cdef inline extractOne_dict(CachedScorerContext context, choices, processor, dou
                 if result_score == 100:
                     break
 
+    trace_extract_end(TRACE_EXTRACT_ONE, result_choice is not None)
     return (result_choice, result_score, result_key) if result_choice is not None else None
 
 
@@ -252,6 +453,7 @@ cdef inline extractOne_distance_dict(CachedDistanceContext context, choices, pro
     result_choice = None
     result_key = None
 
+    trace_extract_start(TRACE_EXTRACT_ONE, choices)
     if processor is not None:
         for choice_key, choice in choices.items():
             if choice is None:
@@ -285,6 +487,7 @@ cdef inline extractOne_distance_dict(CachedDistanceContext context, choices, pro
                 if result_distance == 0:
                     break
 
+    trace_extract_end(TRACE_EXTRACT_ONE, result_choice is not None)
     return (result_choice, result_distance, result_key) if result_choice is not None else None
 
 
@@ -299,8 +502,13 @@ cdef inline extractOne_list(CachedScorerContext context, choices, processor, dou
     cdef double result_score = -1
     cdef size_t i
     cdef size_t result_index = 0
+    cdef size_t lane
+    cdef vector[proc_string] batch_strings
+    cdef vector[size_t] batch_indices
+    cdef vector[double] batch_scores
     result_choice = None
 
+    trace_extract_start(TRACE_EXTRACT_ONE, choices)
     if processor is not None:
         for i, choice in enumerate(choices):
             if choice is None:
@@ -319,6 +527,38 @@ cdef inline extractOne_list(CachedScorerContext context, choices, processor, dou
 
                 if result_score == 100:
                     break
+    elif context.batch_size > 1:
+        # the scorer is able to score multiple choices at once
+        batch_scores.resize(context.batch_size)
+        choice_iter = enumerate(choices)
+        while result_score != 100:
+            batch_strings.clear()
+            batch_indices.clear()
+            # keep the choices alive, since the converted strings might point into them
+            batch_choices = []
+            for i, choice in choice_iter:
+                if choice is None:
+                    continue
+
+                batch_strings.push_back(move(conv_sequence(choice)))
+                batch_indices.push_back(i)
+                batch_choices.append(choice)
+                if batch_strings.size() == context.batch_size:
+                    break
+
+            if batch_strings.empty():
+                break
+
+            trace_batch_start(batch_strings.size())
+            context.ratio_batch(batch_strings.data(), batch_strings.size(), score_cutoff, batch_scores.data())
+            trace_batch_end(batch_strings.size())
+
+            for lane in range(batch_strings.size()):
+                score = batch_scores[lane]
+                if score >= score_cutoff and score > result_score:
+                    result_score = score_cutoff = score
+                    result_choice = batch_choices[lane]
+                    result_index = batch_indices[lane]
     else:
         for i, choice in enumerate(choices):
             if choice is None:
@@ -334,6 +574,7 @@ cdef inline extractOne_list(CachedScorerContext context, choices, processor, dou
                 if result_score == 100:
                     break
 
+    trace_extract_end(TRACE_EXTRACT_ONE, result_choice is not None)
     return (result_choice, result_score, result_index) if result_choice is not None else None
 
 
@@ -347,8 +588,13 @@ cdef inline extractOne_distance_list(CachedDistanceContext context, choices, pro
     cdef size_t result_distance = <size_t>-1
     cdef size_t i
     cdef size_t result_index = 0
+    cdef size_t lane
+    cdef vector[proc_string] batch_strings
+    cdef vector[size_t] batch_indices
+    cdef vector[size_t] batch_distances
     result_choice = None
 
+    trace_extract_start(TRACE_EXTRACT_ONE, choices)
     if processor is not None:
         for i, choice in enumerate(choices):
             if choice is None:
@@ -367,6 +613,38 @@ cdef inline extractOne_distance_list(CachedDistanceContext context, choices, pro
 
                 if result_distance == 0:
                     break
+    elif context.batch_size > 1:
+        # the scorer is able to score multiple choices at once
+        batch_distances.resize(context.batch_size)
+        choice_iter = enumerate(choices)
+        while result_distance != 0:
+            batch_strings.clear()
+            batch_indices.clear()
+            # keep the choices alive, since the converted strings might point into them
+            batch_choices = []
+            for i, choice in choice_iter:
+                if choice is None:
+                    continue
+
+                batch_strings.push_back(move(conv_sequence(choice)))
+                batch_indices.push_back(i)
+                batch_choices.append(choice)
+                if batch_strings.size() == context.batch_size:
+                    break
+
+            if batch_strings.empty():
+                break
+
+            trace_batch_start(batch_strings.size())
+            context.ratio_batch(batch_strings.data(), batch_strings.size(), max_, batch_distances.data())
+            trace_batch_end(batch_strings.size())
+
+            for lane in range(batch_strings.size()):
+                distance = batch_distances[lane]
+                if distance <= max_ and distance < result_distance:
+                    result_distance = max_ = distance
+                    result_choice = batch_choices[lane]
+                    result_index = batch_indices[lane]
     else:
         for i, choice in enumerate(choices):
             if choice is None:
@@ -382,6 +660,7 @@ cdef inline extractOne_distance_list(CachedDistanceContext context, choices, pro
                 if result_distance == 0:
                     break
 
+    trace_extract_end(TRACE_EXTRACT_ONE, result_choice is not None)
     return (result_choice, result_distance, result_index) if result_choice is not None else None
 
 
@@ -468,7 +747,263 @@ cdef inline py_extractOne_list(query, choices, scorer, processor, double score_c
     return (result_choice, result_score, result_index) if result_choice is not None else None
 
 
-def extractOne(query, choices, *, scorer=WRatio, processor=default_process, score_cutoff=None, **kwargs):
+cdef inline list extract_alignment(query, choices, processor, score_cutoff, limit, bint extract_one, dict stats):
+    """
+    implementation of extract and extractOne for scorer = fuzz.partial_ratio_alignment.
+    The alignment is returned by the scan, so it is not calculated a second
+    time for the results. extractOne raises score_cutoff after each match
+    """
+    cdef int def_process = 0
+    cdef double c_score_cutoff = 0.0
+    cdef double result_score = -1
+    cdef CppScoreAlignment alignment
+    cdef CachedAlignmentContext context
+    cdef size_t scanned = 0
+    cdef size_t skipped = 0
+    cdef size_t rejected = 0
+    cdef list results = []
+
+    if processor is default_process or (processor and not callable(processor)):
+        def_process = 1
+        query = default_process(query)
+        processor = None
+    elif callable(processor):
+        query = processor(query)
+    else:
+        processor = None
+
+    if score_cutoff is not None:
+        c_score_cutoff = score_cutoff
+    if c_score_cutoff < 0 or c_score_cutoff > 100:
+        raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
+
+    context = cached_partial_ratio_alignment_init(conv_sequence(query), def_process)
+    choice_iter = choices.items() if hasattr(choices, "items") else enumerate(choices)
+    for key, choice in choice_iter:
+        if choice is None:
+            skipped += 1
+            continue
+
+        proc_choice = processor(choice) if processor is not None else choice
+        if proc_choice is None:
+            skipped += 1
+            continue
+
+        scanned += 1
+        alignment = context.alignment(conv_sequence(proc_choice), c_score_cutoff)
+        if alignment.score < c_score_cutoff or (extract_one and alignment.score <= result_score):
+            rejected += 1
+            continue
+
+        result = (choice, ScoreAlignment(alignment.score, alignment.src_start, alignment.src_end,
+            alignment.dest_start, alignment.dest_end), key)
+        if extract_one:
+            results = [result]
+            result_score = c_score_cutoff = alignment.score
+            if result_score == 100:
+                break
+        else:
+            results.append(result)
+
+    if stats is not None:
+        for name, value in (("choices_scanned", scanned), ("choices_skipped", skipped), ("choices_rejected", rejected)):
+            stats[name] = stats.get(name, 0) + value
+
+    # the sort is stable, so matches with the same score are sorted by index
+    results.sort(key=lambda i: i[1].score, reverse=True)
+    return results[:limit]
+
+
+cdef enum ScanKind:
+    SCAN_SCORER
+    SCAN_DISTANCE
+    SCAN_PYTHON
+
+cdef class ExtractScan:
+    """
+    iterates over the choices like the implementations of extractOne, extract
+    and extract_iter and yields the matches in form of `(choice, score, key)`,
+    while recording the statistics requested using `stats`. The choices are
+    scored one at a time, so scorers supporting batches are not used.
+    """
+    cdef int kind
+    cdef CachedScorerContext scorer_context
+    cdef CachedDistanceContext distance_context
+    cdef object query
+    cdef object scorer
+    cdef object processor
+    cdef dict kwargs
+    cdef object choice_iter
+    # extractOne raises the cutoffs after each match
+    cdef double score_cutoff
+    cdef size_t max_
+
+    cdef size_t scanned
+    cdef size_t skipped
+    cdef size_t rejected
+    cdef size_t early_exits
+    cdef int64_t processor_ns
+    cdef int64_t conversion_ns
+    cdef int64_t scorer_ns
+    cdef int64_t result_ns
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        cdef int64_t start
+        cdef int64_t stop
+        cdef proc_string proc_str
+        cdef double score
+        cdef size_t distance
+        cdef bint accepted
+        cdef bint early_exit
+
+        for key, choice in self.choice_iter:
+            if choice is None:
+                self.skipped += 1
+                continue
+
+            proc_choice = choice
+            if self.processor is not None:
+                start = monotonic_ns()
+                proc_choice = self.processor(choice)
+                self.processor_ns += monotonic_ns() - start
+                # the Python scorers receive the processed choice even when it is None
+                if proc_choice is None and self.kind != SCAN_PYTHON:
+                    self.skipped += 1
+                    continue
+
+            self.scanned += 1
+            if self.kind == SCAN_PYTHON:
+                start = monotonic_ns()
+                result_score = self.scorer(self.query, proc_choice,
+                    processor=None, score_cutoff=self.score_cutoff, **self.kwargs)
+                self.scorer_ns += monotonic_ns() - start
+                accepted = result_score >= self.score_cutoff
+                early_exit = result_score == 0
+            else:
+                start = monotonic_ns()
+                proc_str = conv_sequence(proc_choice)
+                stop = monotonic_ns()
+                self.conversion_ns += stop - start
+
+                if self.kind == SCAN_SCORER:
+                    score = self.scorer_context.ratio(proc_str, self.score_cutoff)
+                    accepted = score >= self.score_cutoff
+                    early_exit = score == 0
+                    result_score = score
+                else:
+                    distance = self.distance_context.ratio(proc_str, self.max_)
+                    accepted = distance <= self.max_
+                    early_exit = distance == <size_t>-1
+                    result_score = distance
+                self.scorer_ns += monotonic_ns() - stop
+
+            if not accepted:
+                # the scorers return 0 (or -1 for distances), when they exit early
+                self.rejected += 1
+                self.early_exits += early_exit
+                continue
+
+            start = monotonic_ns()
+            result = (choice, result_score, key)
+            self.result_ns += monotonic_ns() - start
+            return result
+
+        raise StopIteration
+
+    cdef void update_stats(self, dict stats) except *:
+        for key, value in (
+            ("choices_scanned", self.scanned),
+            ("choices_skipped", self.skipped),
+            ("choices_rejected", self.rejected),
+            ("scorer_early_exits", self.early_exits),
+            ("processor_ns", self.processor_ns),
+            ("conversion_ns", self.conversion_ns),
+            ("scorer_ns", self.scorer_ns),
+            ("result_ns", self.result_ns)
+        ):
+            stats[key] = stats.get(key, 0) + value
+
+
+cdef inline ExtractScan make_scan(int kind, query, choices, processor):
+    cdef ExtractScan scan = ExtractScan.__new__(ExtractScan)
+    scan.kind = kind
+    scan.query = query
+    scan.processor = processor
+    scan.choice_iter = iter(choices.items()) if hasattr(choices, "items") else enumerate(choices)
+    return scan
+
+
+cdef inline ExtractScan scorer_scan(CachedScorerContext context, double score_cutoff, query, choices, processor):
+    cdef ExtractScan scan = make_scan(SCAN_SCORER, query, choices, processor)
+    scan.scorer_context = move(context)
+    scan.score_cutoff = score_cutoff
+    return scan
+
+
+cdef inline ExtractScan distance_scan(CachedDistanceContext context, size_t max_, query, choices, processor):
+    cdef ExtractScan scan = make_scan(SCAN_DISTANCE, query, choices, processor)
+    scan.distance_context = move(context)
+    scan.max_ = max_
+    return scan
+
+
+cdef inline ExtractScan py_scan(scorer, double score_cutoff, dict kwargs, query, choices, processor):
+    cdef ExtractScan scan = make_scan(SCAN_PYTHON, query, choices, processor)
+    scan.scorer = scorer
+    scan.score_cutoff = score_cutoff
+    scan.kwargs = kwargs
+    return scan
+
+
+cdef inline extractOne_stats(ExtractScan scan, dict stats):
+    result = None
+    try:
+        for choice, score, key in scan:
+            if scan.kind == SCAN_DISTANCE:
+                if result is not None and score >= result[1]:
+                    continue
+                scan.max_ = score
+            else:
+                if result is not None and score <= result[1]:
+                    continue
+                scan.score_cutoff = score
+
+            result = (choice, score, key)
+            if (scan.kind == SCAN_DISTANCE and score == 0) or \
+                    (scan.kind in (SCAN_SCORER, SCAN_PYTHON) and score == 100):
+                break
+    finally:
+        scan.update_stats(stats)
+    return result
+
+
+cdef inline extract_stats(ExtractScan scan, size_t limit, dict stats):
+    cdef int64_t start
+    try:
+        results = list(scan)
+        # the sort is stable, so matches with the same score are sorted by index
+        start = monotonic_ns()
+        trace_sort_start(len(results))
+        results.sort(key=lambda i: i[1], reverse=scan.kind != SCAN_DISTANCE)
+        del results[limit:]
+        trace_sort_end(len(results))
+        scan.result_ns += monotonic_ns() - start
+    finally:
+        scan.update_stats(stats)
+    return results
+
+
+def extract_iter_stats(ExtractScan scan, dict stats):
+    try:
+        yield from scan
+    finally:
+        scan.update_stats(stats)
+
+
+def extractOne(query, choices, *, scorer=WRatio, processor=default_process, score_cutoff=None, stats=None, **kwargs):
     """
     Find the best match in a list of choices. When multiple elements have the same similarity,
     the first element is returned.
@@ -485,7 +1020,9 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
         the query and each choice. This can be any of the scorers included in RapidFuzz
         (both scorers that calculate the edit distance or the normalized edit distance), or
         a custom function, which returns a normalized edit distance.
-        fuzz.WRatio is used by default.
+        fuzz.WRatio is used by default. When fuzz.partial_ratio_alignment is used,
+        the choices are scored using fuzz.partial_ratio and the score of the result
+        is replaced by its ScoreAlignment.
     processor : Callable, optional
         Optional callable that reformats the strings.
         utils.default_process is used by default, which lowercases the strings and trims whitespace
@@ -495,6 +1032,15 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
         normalized edit distance is used this represents the minimal similarity
         and matches with a `similarity >= score_cutoff` are ignored. For edit distances this defaults to
         -1, while for normalized edit distances this defaults to 0.0, which deactivates this behaviour.
+    stats : dict, optional
+        Optional dict, which statistics about the call are added to. The keys are
+        `choices_scanned` (choices passed to the scorer), `choices_skipped` (None or
+        processed to None), `choices_rejected` (not reaching score_cutoff) and
+        `scorer_early_exits` (rejected choices, for which the scorer exited early and
+        returned 0, or -1 for edit distances). The time spent in the processor, the
+        conversion of the choices, the scorer and building the results is added to
+        `processor_ns`, `conversion_ns`, `scorer_ns` and `result_ns`. The choices are
+        scored one at a time, so this is slower than a call without `stats`.
     **kwargs : Any, optional
         any other named parameters are passed to the scorer. This can be used to pass
         e.g. weights to string_metric.levenshtein
@@ -515,6 +1061,9 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
           * A normalized edit distance (similarity is a score between 0 and 100, with 100 being a perfect match).
             In this case only choices which have a `similarity >= score_cutoff` are returned.
             An example of a scorer with this behavior is `string_metric.normalized_levenshtein`.
+          * A similarity (similarity is the length of the longest common subsequence).
+            In this case only choices which have a `similarity >= score_cutoff` are returned.
+            An example of a scorer with this behavior is `string_metric.lcs_seq`.
 
           Note, that for all scorers, which are not provided by RapidFuzz, only normalized edit distances are supported.
 
@@ -596,6 +1145,10 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
     if query is None:
         return None
 
+    if scorer is partial_ratio_alignment:
+        results = extract_alignment(query, choices, processor, score_cutoff, 1, True, stats)
+        return results[0] if results else None
+
     # preprocess the query
     if processor is default_process:
         def_process = 1
@@ -625,6 +1178,8 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
         if c_score_cutoff < 0 or c_score_cutoff > 100:
             raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
 
+        if stats is not None:
+            return extractOne_stats(scorer_scan(move(ScorerContext), c_score_cutoff, query, choices, processor), stats)
         if hasattr(choices, "items"):
             return extractOne_dict(move(ScorerContext), choices, processor, c_score_cutoff)
         else:
@@ -637,15 +1192,33 @@ def extractOne(query, choices, *, scorer=WRatio, processor=default_process, scor
         if score_cutoff is not None and score_cutoff != -1:
             c_max = score_cutoff
 
+        if stats is not None:
+            return extractOne_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), stats)
         if hasattr(choices, "items"):
             return extractOne_distance_dict(move(DistanceContext), choices, processor, c_max)
         else:
             return extractOne_distance_list(move(DistanceContext), choices, processor, c_max)
 
+    if IsIntegratedSimilarity(scorer):
+        # similarity implemented in C++
+        query_context = conv_sequence(query)
+        DistanceContext = CachedSimilarityInit(scorer, query_context, def_process, kwargs)
+        c_max = similarity_to_max(score_cutoff or 0)
+
+        if stats is not None:
+            result = extractOne_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), stats)
+        elif hasattr(choices, "items"):
+            result = extractOne_distance_dict(move(DistanceContext), choices, processor, c_max)
+        else:
+            result = extractOne_distance_list(move(DistanceContext), choices, processor, c_max)
+        return similarity_result(result) if result is not None else None
+
     # the scorer has to be called through Python
     if score_cutoff is not None:
         c_score_cutoff = score_cutoff
 
+    if stats is not None:
+        return extractOne_stats(py_scan(scorer, c_score_cutoff, kwargs, query, choices, processor), stats)
     if hasattr(choices, "items"):
         return py_extractOne_dict(query, choices, scorer, processor, c_score_cutoff, kwargs)
     else:
@@ -661,6 +1234,7 @@ cdef inline extract_dict(CachedScorerContext context, choices, processor, size_t
     results.reserve(<size_t>len(choices))
     cdef list result_list
 
+    trace_extract_start(TRACE_EXTRACT, choices)
     try:
         if processor is not None:
             for i, (choice_key, choice) in enumerate(choices.items()):
@@ -697,11 +1271,13 @@ cdef inline extract_dict(CachedScorerContext context, choices, processor, size_t
         if limit > results.size():
             limit = results.size()
 
+        trace_sort_start(results.size())
         if limit >= results.size():
             algorithm.sort(results.begin(), results.end(), ExtractScorerComp())
         else:
             algorithm.partial_sort(results.begin(), results.begin() + <ptrdiff_t>limit, results.end(), ExtractScorerComp())
             results.resize(limit)
+        trace_sort_end(limit)
 
         # copy elements into Python List
         result_list = PyList_New(<Py_ssize_t>limit)
@@ -716,6 +1292,7 @@ cdef inline extract_dict(CachedScorerContext context, choices, processor, size_t
             Py_DECREF(<object>item.choice)
             Py_DECREF(<object>item.key)
 
+    trace_extract_end(TRACE_EXTRACT, limit)
     return result_list
 
 
@@ -728,6 +1305,7 @@ cdef inline extract_distance_dict(CachedDistanceContext context, choices, proces
     results.reserve(<size_t>len(choices))
     cdef list result_list
 
+    trace_extract_start(TRACE_EXTRACT, choices)
     try:
         if processor is not None:
             for i, (choice_key, choice) in enumerate(choices.items()):
@@ -764,11 +1342,13 @@ cdef inline extract_distance_dict(CachedDistanceContext context, choices, proces
         if limit > results.size():
             limit = results.size()
 
+        trace_sort_start(results.size())
         if limit >= results.size():
             algorithm.sort(results.begin(), results.end(), ExtractDistanceComp())
         else:
             algorithm.partial_sort(results.begin(), results.begin() + <ptrdiff_t>limit, results.end(), ExtractDistanceComp())
             results.resize(limit)
+        trace_sort_end(limit)
 
         # copy elements into Python List
         result_list = PyList_New(<Py_ssize_t>limit)
@@ -783,17 +1363,23 @@ cdef inline extract_distance_dict(CachedDistanceContext context, choices, proces
             Py_DECREF(<object>item.choice)
             Py_DECREF(<object>item.key)
 
+    trace_extract_end(TRACE_EXTRACT, limit)
     return result_list
 
 
 cdef inline extract_list(CachedScorerContext context, choices, processor, size_t limit, double score_cutoff):
     cdef double score = 0.0
     cdef size_t i
+    cdef size_t lane
     # todo possibly a smaller vector would be good to reduce memory usage
     cdef vector[ListMatchScorerElem] results
     results.reserve(<size_t>len(choices))
     cdef list result_list
+    cdef vector[proc_string] batch_strings
+    cdef vector[size_t] batch_indices
+    cdef vector[double] batch_scores
 
+    trace_extract_start(TRACE_EXTRACT, choices)
     try:
         if processor is not None:
             for i, choice in enumerate(choices):
@@ -809,6 +1395,38 @@ cdef inline extract_list(CachedScorerContext context, choices, processor, size_t
                 if score >= score_cutoff:
                     Py_INCREF(choice)
                     results.push_back(ListMatchScorerElem(score, i, <PyObject*>choice))
+        elif context.batch_size > 1:
+            # the scorer is able to score multiple choices at once
+            batch_scores.resize(context.batch_size)
+            choice_iter = enumerate(choices)
+            while True:
+                batch_strings.clear()
+                batch_indices.clear()
+                # keep the choices alive, since the converted strings might point into them
+                batch_choices = []
+                for i, choice in choice_iter:
+                    if choice is None:
+                        continue
+
+                    batch_strings.push_back(move(conv_sequence(choice)))
+                    batch_indices.push_back(i)
+                    batch_choices.append(choice)
+                    if batch_strings.size() == context.batch_size:
+                        break
+
+                if batch_strings.empty():
+                    break
+
+                trace_batch_start(batch_strings.size())
+                context.ratio_batch(batch_strings.data(), batch_strings.size(), score_cutoff, batch_scores.data())
+                trace_batch_end(batch_strings.size())
+
+                for lane in range(batch_strings.size()):
+                    score = batch_scores[lane]
+                    if score >= score_cutoff:
+                        choice = batch_choices[lane]
+                        Py_INCREF(choice)
+                        results.push_back(ListMatchScorerElem(score, batch_indices[lane], <PyObject*>choice))
         else:
             for i, choice in enumerate(choices):
                 if choice is None:
@@ -824,11 +1442,13 @@ cdef inline extract_list(CachedScorerContext context, choices, processor, size_t
         if limit > results.size():
             limit = results.size()
     
+        trace_sort_start(results.size())
         if limit >= results.size():
             algorithm.sort(results.begin(), results.end(), ExtractScorerComp())
         else:
             algorithm.partial_sort(results.begin(), results.begin() + <ptrdiff_t>limit, results.end(), ExtractScorerComp())
             results.resize(limit)
+        trace_sort_end(limit)
     
         # copy elements into Python List
         result_list = PyList_New(<Py_ssize_t>limit)
@@ -842,17 +1462,23 @@ cdef inline extract_list(CachedScorerContext context, choices, processor, size_t
         for item in results:
             Py_DECREF(<object>item.choice)
 
+    trace_extract_end(TRACE_EXTRACT, limit)
     return result_list
 
 
 cdef inline extract_distance_list(CachedDistanceContext context, choices, processor, size_t limit, size_t max_):
     cdef size_t distance
     cdef size_t i
+    cdef size_t lane
     # todo possibly a smaller vector would be good to reduce memory usage
     cdef vector[ListMatchDistanceElem] results
     results.reserve(<size_t>len(choices))
     cdef list result_list
+    cdef vector[proc_string] batch_strings
+    cdef vector[size_t] batch_indices
+    cdef vector[size_t] batch_distances
 
+    trace_extract_start(TRACE_EXTRACT, choices)
     try:
         if processor is not None:
             for i, choice in enumerate(choices):
@@ -868,6 +1494,38 @@ cdef inline extract_distance_list(CachedDistanceContext context, choices, proces
                 if distance <= max_:
                     Py_INCREF(choice)
                     results.push_back(ListMatchDistanceElem(distance, i, <PyObject*>choice))
+        elif context.batch_size > 1:
+            # the scorer is able to score multiple choices at once
+            batch_distances.resize(context.batch_size)
+            choice_iter = enumerate(choices)
+            while True:
+                batch_strings.clear()
+                batch_indices.clear()
+                # keep the choices alive, since the converted strings might point into them
+                batch_choices = []
+                for i, choice in choice_iter:
+                    if choice is None:
+                        continue
+
+                    batch_strings.push_back(move(conv_sequence(choice)))
+                    batch_indices.push_back(i)
+                    batch_choices.append(choice)
+                    if batch_strings.size() == context.batch_size:
+                        break
+
+                if batch_strings.empty():
+                    break
+
+                trace_batch_start(batch_strings.size())
+                context.ratio_batch(batch_strings.data(), batch_strings.size(), max_, batch_distances.data())
+                trace_batch_end(batch_strings.size())
+
+                for lane in range(batch_strings.size()):
+                    distance = batch_distances[lane]
+                    if distance <= max_:
+                        choice = batch_choices[lane]
+                        Py_INCREF(choice)
+                        results.push_back(ListMatchDistanceElem(distance, batch_indices[lane], <PyObject*>choice))
         else:
             for i, choice in enumerate(choices):
                 if choice is None:
@@ -883,11 +1541,13 @@ cdef inline extract_distance_list(CachedDistanceContext context, choices, proces
         if limit > results.size():
             limit = results.size()
     
+        trace_sort_start(results.size())
         if limit >= results.size():
             algorithm.sort(results.begin(), results.end(), ExtractDistanceComp())
         else:
             algorithm.partial_sort(results.begin(), results.begin() + <ptrdiff_t>limit, results.end(), ExtractDistanceComp())
             results.resize(limit)
+        trace_sort_end(limit)
     
         # copy elements into Python List
         result_list = PyList_New(<Py_ssize_t>limit)
@@ -901,6 +1561,7 @@ cdef inline extract_distance_list(CachedDistanceContext context, choices, proces
         for item in results:
             Py_DECREF(<object>item.choice)
 
+    trace_extract_end(TRACE_EXTRACT, limit)
     return result_list
 
 cdef inline py_extract_dict(query, choices, scorer, processor, size_t limit, double score_cutoff, kwargs):
@@ -962,7 +1623,7 @@ cdef inline py_extract_list(query, choices, scorer, processor, size_t limit, dou
     return heapq.nlargest(limit, result_list, key=lambda i: i[1])
 
 
-def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5, score_cutoff=None, **kwargs):
+def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5, score_cutoff=None, stats=None, **kwargs):
     """
     Find the best matches in a list of choices. The list is sorted by the similarity.
     When multiple choices have the same similarity, they are sorted by their index
@@ -979,7 +1640,9 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
         the query and each choice. This can be any of the scorers included in RapidFuzz
         (both scorers that calculate the edit distance or the normalized edit distance), or
         a custom function, which returns a normalized edit distance.
-        fuzz.WRatio is used by default.
+        fuzz.WRatio is used by default. When fuzz.partial_ratio_alignment is used,
+        the choices are scored using fuzz.partial_ratio and the score of the result
+        is replaced by its ScoreAlignment.
     processor : Callable, optional
         Optional callable that reformats the strings.
         utils.default_process is used by default, which lowercases the strings and trims whitespace
@@ -991,6 +1654,15 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
         normalized edit distance is used this represents the minimal similarity
         and matches with a `similarity >= score_cutoff` are ignored. For edit distances this defaults to
         -1, while for normalized edit distances this defaults to 0.0, which deactivates this behaviour.
+    stats : dict, optional
+        Optional dict, which statistics about the call are added to. The keys are
+        `choices_scanned` (choices passed to the scorer), `choices_skipped` (None or
+        processed to None), `choices_rejected` (not reaching score_cutoff) and
+        `scorer_early_exits` (rejected choices, for which the scorer exited early and
+        returned 0, or -1 for edit distances). The time spent in the processor, the
+        conversion of the choices, the scorer and building the results is added to
+        `processor_ns`, `conversion_ns`, `scorer_ns` and `result_ns`. The choices are
+        scored one at a time, so this is slower than a call without `stats`.
     **kwargs : Any, optional
         any other named parameters are passed to the scorer. This can be used to pass
         e.g. weights to string_metric.levenshtein
@@ -1011,6 +1683,9 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
           * A normalized edit distance (similarity is a score between 0 and 100, with 100 being a perfect match).
             In this case only choices which have a `similarity >= score_cutoff` are returned.
             An example of a scorer with this behavior is `string_metric.normalized_levenshtein`.
+          * A similarity (similarity is the length of the longest common subsequence).
+            In this case only choices which have a `similarity >= score_cutoff` are returned.
+            An example of a scorer with this behavior is `string_metric.lcs_seq`.
 
           Note, that for all scorers, which are not provided by RapidFuzz, only normalized edit distances are supported.
 
@@ -1032,6 +1707,9 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
     if query is None:
         return []
 
+    if scorer is partial_ratio_alignment:
+        return extract_alignment(query, choices, processor, score_cutoff, limit, False, stats)
+
     if limit is None or limit > len(choices):
         limit = len(choices)
 
@@ -1063,6 +1741,8 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
         if c_score_cutoff < 0 or c_score_cutoff > 100:
             raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
 
+        if stats is not None:
+            return extract_stats(scorer_scan(move(ScorerContext), c_score_cutoff, query, choices, processor), limit, stats)
         if hasattr(choices, "items"):
             return extract_dict(move(ScorerContext), choices, processor, limit, c_score_cutoff)
         else:
@@ -1075,22 +1755,40 @@ def extract(query, choices, *, scorer=WRatio, processor=default_process, limit=5
         if score_cutoff is not None and score_cutoff != -1:
             c_max = score_cutoff
 
+        if stats is not None:
+            return extract_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), limit, stats)
         if hasattr(choices, "items"):
             return extract_distance_dict(move(DistanceContext), choices, processor, limit, c_max)
         else:
             return extract_distance_list(move(DistanceContext), choices, processor, limit, c_max)
 
+    if IsIntegratedSimilarity(scorer):
+        # similarity implemented in C++
+        query_context = conv_sequence(query)
+        DistanceContext = CachedSimilarityInit(scorer, query_context, def_process, kwargs)
+        c_max = similarity_to_max(score_cutoff or 0)
+
+        if stats is not None:
+            results = extract_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), limit, stats)
+        elif hasattr(choices, "items"):
+            results = extract_distance_dict(move(DistanceContext), choices, processor, limit, c_max)
+        else:
+            results = extract_distance_list(move(DistanceContext), choices, processor, limit, c_max)
+        return [similarity_result(result) for result in results]
+
     # the scorer has to be called through Python
     if score_cutoff is not None:
         c_score_cutoff = score_cutoff
 
+    if stats is not None:
+        return extract_stats(py_scan(scorer, c_score_cutoff, kwargs, query, choices, processor), limit, stats)
     if hasattr(choices, "items"):
         return py_extract_dict(query, choices, scorer, processor, limit, c_score_cutoff, kwargs)
     else:
         return py_extract_list(query, choices, scorer, processor, limit, c_score_cutoff, kwargs)
 
 
-def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, score_cutoff=None, **kwargs):
+def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, score_cutoff=None, stats=None, **kwargs):
     """
     Find the best match in a list of choices
 
@@ -1116,6 +1814,15 @@ def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, sc
         normalized edit distance is used this represents the minimal similarity
         and matches with a `similarity >= score_cutoff` are ignored. For edit distances this defaults to
         -1, while for normalized edit distances this defaults to 0.0, which deactivates this behaviour.
+    stats : dict, optional
+        Optional dict, which statistics about the call are added to. The keys are
+        `choices_scanned` (choices passed to the scorer), `choices_skipped` (None or
+        processed to None), `choices_rejected` (not reaching score_cutoff) and
+        `scorer_early_exits` (rejected choices, for which the scorer exited early and
+        returned 0, or -1 for edit distances). The time spent in the processor, the
+        conversion of the choices, the scorer and building the results is added to
+        `processor_ns`, `conversion_ns`, `scorer_ns` and `result_ns`. The choices are
+        scored one at a time, so this is slower than a call without `stats`.
     **kwargs : Any, optional
         any other named parameters are passed to the scorer. This can be used to pass
         e.g. weights to string_metric.levenshtein
@@ -1136,6 +1843,9 @@ def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, sc
           * A normalized edit distance (similarity is a score between 0 and 100, with 100 being a perfect match).
             In this case only choices which have a `similarity >= score_cutoff` are yielded.
             An example of a scorer with this behavior is `string_metric.normalized_levenshtein`.
+          * A similarity (similarity is the length of the longest common subsequence).
+            In this case only choices which have a `similarity >= score_cutoff` are yielded.
+            An example of a scorer with this behavior is `string_metric.lcs_seq`.
 
           Note, that for all scorers, which are not provided by RapidFuzz, only normalized edit distances are supported.
 
@@ -1366,7 +2076,9 @@ def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, sc
         if c_score_cutoff < 0 or c_score_cutoff > 100:
             raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
 
-        if hasattr(choices, "items"):
+        if stats is not None:
+            yield from extract_iter_stats(scorer_scan(move(ScorerContext), c_score_cutoff, query, choices, processor), stats)
+        elif hasattr(choices, "items"):
             yield from extract_iter_dict()
         else:
             yield from extract_iter_list()
@@ -1380,18 +2092,953 @@ def extract_iter(query, choices, *, scorer=WRatio, processor=default_process, sc
         if score_cutoff is not None and score_cutoff != -1:
             c_max = score_cutoff
 
-        if hasattr(choices, "items"):
+        if stats is not None:
+            yield from extract_iter_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), stats)
+        elif hasattr(choices, "items"):
             yield from extract_iter_distance_dict()
         else:
             yield from extract_iter_distance_list()
         # finish generator
         return
 
+    if IsIntegratedSimilarity(scorer):
+        # similarity implemented in C++
+        query_context = conv_sequence(query)
+        DistanceContext = CachedSimilarityInit(scorer, query_context, def_process, kwargs)
+        c_max = similarity_to_max(score_cutoff or 0)
+
+        if stats is not None:
+            results = extract_iter_stats(distance_scan(move(DistanceContext), c_max, query, choices, processor), stats)
+        elif hasattr(choices, "items"):
+            results = extract_iter_distance_dict()
+        else:
+            results = extract_iter_distance_list()
+        for result in results:
+            yield similarity_result(result)
+        # finish generator
+        return
+
     # the scorer has to be called through Python
     if score_cutoff is not None:
         c_score_cutoff = score_cutoff
 
-    if hasattr(choices, "items"):
+    if stats is not None:
+        yield from extract_iter_stats(py_scan(scorer, c_score_cutoff, kwargs, query, choices, processor), stats)
+    elif hasattr(choices, "items"):
         yield from py_extract_iter_dict()
     else:
         yield from py_extract_iter_list()
+
+
+cdef inline size_t conv_workers(workers) except *:
+    if workers == -1:
+        return 0
+    elif workers < 1:
+        raise ValueError("workers has to be -1 or a positive integer")
+    return workers
+
+
+cdef class FingerprintCorpus:
+    """
+    Corpus of binary fingerprints like perceptual hashes or simhashes, which
+    are compared using the hamming distance of their bits.
+
+    Parameters
+    ----------
+    fingerprints : Iterable, optional
+        fingerprints added to the corpus
+    bits : int, optional
+        bits of each fingerprint. This has to be a multiple of 64 and defaults to 64.
+
+    Notes
+    -----
+    A fingerprint can be passed either as a non negative int or as bytes
+    in big-endian order, with a length of `bits / 8`. The fingerprints are
+    stored in a single contiguous array of 64 bit words and compared using
+    xor and popcount, so scanning the corpus only requires a few instructions
+    per fingerprint. Searches on large corpora can be split across multiple
+    threads using `workers`. The GIL is released during searches, so they can
+    run in parallel, but `add` and `build_index` raise a RuntimeError while
+    a search is running.
+
+    Radius searches can use multi-index hashing [1]_ after calling `build_index`.
+    The fingerprints are split into m substrings, which are stored in hash tables.
+    Every fingerprint within a distance r of the query shares at least one
+    substring within a distance of r / m of the corresponding substring of the
+    query, so only these candidates are compared. This makes searches with a small
+    radius sublinear in the size of the corpus.
+
+    References
+    ----------
+    .. [1] Norouzi, Mohammad, Ali Punjani, and David J. Fleet.
+       "Fast search in hamming space with multi-index hashing."
+       2012 IEEE Conference on Computer Vision and Pattern Recognition. 2012.
+
+    Examples
+    --------
+    >>> from rapidfuzz.process import FingerprintCorpus
+    >>> corpus = FingerprintCorpus([0b1011, 0b0110, 0xFF])
+    >>> corpus.extractOne(0b1001)
+    (11, 1, 0)
+    >>> corpus.extract_radius(0b1111, 2)
+    [(11, 1, 0), (6, 2, 1)]
+    """
+    cdef CppFingerprintCorpus* corpus
+    # searches running without the GIL, which prevent modifications
+    cdef size_t searches
+
+    def __cinit__(self, fingerprints=(), *, size_t bits=64):
+        self.corpus = new CppFingerprintCorpus(bits)
+        if self.corpus == NULL:
+            raise MemoryError
+
+    def __init__(self, fingerprints=(), *, size_t bits=64):
+        for fingerprint in fingerprints:
+            self.add(fingerprint)
+
+    def __dealloc__(self):
+        del self.corpus
+
+    @property
+    def bits(self):
+        """bits of each fingerprint"""
+        return self.corpus.bits()
+
+    def __len__(self):
+        return self.corpus.size()
+
+    def __getitem__(self, index):
+        cdef size_t size = self.corpus.size()
+        if index < 0:
+            index += size
+        if not 0 <= index < size:
+            raise IndexError("FingerprintCorpus index out of range")
+        return self._to_int(self.corpus.get(index))
+
+    cdef vector[uint64_t] _to_words(self, fingerprint) except *:
+        cdef size_t bits = self.corpus.bits()
+        cdef vector[uint64_t] words
+
+        if isinstance(fingerprint, (bytes, bytearray)):
+            if len(fingerprint) * 8 != bits:
+                raise ValueError("fingerprint has to be {} bytes long".format(bits // 8))
+            fingerprint = int.from_bytes(fingerprint, "big")
+        elif not isinstance(fingerprint, int):
+            raise TypeError("fingerprint has to be an int or bytes")
+
+        if fingerprint < 0 or fingerprint >> bits:
+            raise ValueError("fingerprint has to be a non negative integer with up to {} bits".format(bits))
+
+        for _ in range(bits // 64):
+            words.push_back(fingerprint & 0xFFFFFFFFFFFFFFFF)
+            fingerprint >>= 64
+        return words
+
+    cdef object _to_int(self, const uint64_t* words):
+        fingerprint = 0
+        for i in reversed(range(self.corpus.bits() // 64)):
+            fingerprint = (fingerprint << 64) | words[i]
+        return fingerprint
+
+    cdef _check_unused(self):
+        if self.searches:
+            raise RuntimeError("FingerprintCorpus can not be modified during a search")
+
+    cdef list _to_results(self, const vector[FingerprintMatch]& matches):
+        cdef size_t i
+        cdef list results = []
+        for i in range(matches.size()):
+            results.append((self._to_int(self.corpus.get(matches[i].index)), matches[i].distance, matches[i].index))
+        return results
+
+    def add(self, fingerprint):
+        """
+        Add a fingerprint to the end of the corpus
+
+        Parameters
+        ----------
+        fingerprint : int or bytes
+            fingerprint with `bits` bits
+        """
+        cdef vector[uint64_t] words = self._to_words(fingerprint)
+        self._check_unused()
+        self.corpus.add(words.data())
+
+    def build_index(self, substrings=None):
+        """
+        Build the hash tables used by `extract_radius` for multi-index hashing.
+        Fingerprints added afterwards are added to the index as well.
+
+        Parameters
+        ----------
+        substrings : int, optional
+            Amount of substrings each fingerprint is split into. Each substring
+            can have up to 64 bits. Defaults to `bits / 16`. More substrings
+            allow efficient searches with a larger radius, but each substring
+            requires a separate hash table.
+        """
+        if substrings is None:
+            substrings = self.corpus.bits() // 16
+        self._check_unused()
+        self.corpus.build_index(substrings)
+
+    def extract(self, query, *, limit=5, max=None, workers=1):
+        """
+        Find the fingerprints closest to the query
+
+        Parameters
+        ----------
+        query : int or bytes
+            fingerprint we want to find
+        limit : int, optional
+            maximum amount of results to return. None returns all results.
+            Defaults to 5
+        max : int, optional
+            Maximum hamming distance between the query and a fingerprint.
+            Fingerprints with a `distance > max` are ignored. Default is None,
+            which deactivates this behaviour.
+        workers : int, optional
+            The corpus is split into chunks of at least 32768 fingerprints,
+            which are scanned in parallel by up to `workers` threads.
+            -1 uses all available cores. Default is 1.
+
+        Returns
+        -------
+        List[Tuple[int, int, int]]
+            The best matches in form of a Tuple with 3 elements
+            `(fingerprint, distance, index)` sorted by distance. Matches with
+            the same distance are sorted by their index.
+        """
+        cdef vector[uint64_t] words = self._to_words(query)
+        cdef size_t c_limit = self.corpus.size() if limit is None else limit
+        cdef size_t c_max = <size_t>-1 if max is None else max
+        cdef size_t c_workers = conv_workers(workers)
+        cdef vector[FingerprintMatch] matches
+
+        self.searches += 1
+        try:
+            with nogil:
+                matches = self.corpus.extract(words.data(), c_limit, c_max, c_workers)
+        finally:
+            self.searches -= 1
+        return self._to_results(matches)
+
+    def extractOne(self, query, *, max=None, workers=1):
+        """
+        Find the fingerprint closest to the query
+
+        Parameters
+        ----------
+        query : int or bytes
+            fingerprint we want to find
+        max : int, optional
+            Maximum hamming distance between the query and a fingerprint.
+            Fingerprints with a `distance > max` are ignored. Default is None,
+            which deactivates this behaviour.
+        workers : int, optional
+            Amount of threads used to scan the corpus. -1 uses all available cores.
+            Default is 1.
+
+        Returns
+        -------
+        Tuple[int, int, int]
+            The best match in form of a Tuple `(fingerprint, distance, index)`.
+            When multiple fingerprints have the same distance the first one is returned.
+        None
+            When there is no fingerprint with a `distance <= max`.
+        """
+        result = self.extract(query, limit=1, max=max, workers=workers)
+        return result[0] if result else None
+
+    def extract_radius(self, query, radius, *, workers=1):
+        """
+        Find all fingerprints within a hamming distance of `radius` to the query.
+        When the index was built using `build_index` and the radius is small
+        enough, only the candidates found using multi-index hashing are compared.
+
+        Parameters
+        ----------
+        query : int or bytes
+            fingerprint we want to find
+        radius : int
+            maximum hamming distance between the query and a fingerprint
+        workers : int, optional
+            Amount of threads used to scan the corpus, when it is not searched
+            using the index. -1 uses all available cores. Default is 1.
+
+        Returns
+        -------
+        List[Tuple[int, int, int]]
+            All matches in form of a Tuple with 3 elements
+            `(fingerprint, distance, index)` sorted by distance. Matches with
+            the same distance are sorted by their index.
+        """
+        cdef vector[uint64_t] words = self._to_words(query)
+        cdef size_t c_radius = radius
+        cdef size_t c_workers = conv_workers(workers)
+        cdef vector[FingerprintMatch] matches
+
+        self.searches += 1
+        try:
+            with nogil:
+                matches = self.corpus.extract_radius(words.data(), c_radius, c_workers)
+        finally:
+            self.searches -= 1
+        return self._to_results(matches)
+
+
+cdef class MultiPatternMatcher:
+    """
+    Search many patterns in a text at once. For each pattern the best
+    approximate occurrence in the text is returned.
+
+    Parameters
+    ----------
+    patterns : Iterable
+        patterns, that are searched in the texts
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the patterns and texts
+        before searching. When processor is True ``utils.default_process``
+        is used. The positions refer to the processed text.
+        Default is None, which deactivates this behaviour.
+
+    Notes
+    -----
+    The patterns are scored like in ``string_metric.normalized_find_all``.
+    Patterns with up to 64 characters are packed next to each other into
+    64 bit words, so a single step of the bit-parallel algorithm by Myers [1]_
+    advances all patterns of a word at once. This is a lot faster than
+    searching each pattern separately when there are many short patterns.
+    Longer patterns are searched one after another.
+    The GIL is released while scanning the text.
+
+    References
+    ----------
+    .. [1] Myers, Gene. "A fast bit-vector algorithm for approximate
+           string matching based on dynamic programming."
+           Journal of the ACM (JACM) 46.3 (1999): 395-415.
+
+    Examples
+    --------
+    >>> from rapidfuzz.process import MultiPatternMatcher
+    >>> matcher = MultiPatternMatcher(["needle", "pin", "thread"])
+    >>> matcher.match("a nedle and a pin", score_cutoff=80)
+    [('pin', 100.0, 1, 14, 17), ('needle', 83.33333333333333, 0, 2, 7)]
+    """
+    cdef CppMultiPatternMatcher matcher
+    cdef list patterns
+    cdef object processor
+
+    def __init__(self, patterns, *, processor=None):
+        if processor is True:
+            processor = default_process
+        elif not callable(processor):
+            processor = None
+
+        self.processor = processor
+        self.patterns = list(patterns)
+        for pattern in self.patterns:
+            if processor is not None:
+                pattern = processor(pattern)
+            multi_pattern_add(self.matcher, conv_sequence(pattern))
+        self.matcher.build()
+
+    def __len__(self):
+        return self.matcher.size()
+
+    def match(self, text, *, score_cutoff=None):
+        """
+        Find the best occurrence of each pattern in text
+
+        Parameters
+        ----------
+        text : str
+            String to search in.
+        score_cutoff : float, optional
+            Optional argument for a score threshold as a float between 0 and 100.
+            Patterns with a score < score_cutoff are ignored. Default is None,
+            which includes every pattern, that shares at least one character
+            with the text.
+
+        Returns
+        -------
+        List[Tuple[str, float, int, int, int]]
+            One Tuple `(pattern, score, index, start, end)` for each pattern found
+            in the text, where index is the position of the pattern in patterns and
+            ``text[start:end]`` is the best occurrence. The results are sorted by
+            score. Patterns with the same score are sorted by their index.
+        """
+        cdef double c_score_cutoff = 0 if score_cutoff is None else score_cutoff
+        cdef vector[PatternMatch] matches
+        cdef proc_string c_text
+        cdef size_t i
+        cdef list results = []
+
+        if self.processor is not None:
+            text = self.processor(text)
+        c_text = conv_sequence(text)
+
+        with nogil:
+            matches = multi_pattern_match(self.matcher, c_text, c_score_cutoff)
+
+        for i in range(matches.size()):
+            results.append((
+                self.patterns[matches[i].index], matches[i].score,
+                matches[i].index, matches[i].start, matches[i].end
+            ))
+        return results
+
+
+cdef dict token_corpus_scorers = {
+    token_sort_ratio: TOKEN_SORT_RATIO,
+    token_set_ratio: TOKEN_SET_RATIO,
+    token_ratio: TOKEN_RATIO,
+    partial_token_sort_ratio: PARTIAL_TOKEN_SORT_RATIO,
+    partial_token_set_ratio: PARTIAL_TOKEN_SET_RATIO,
+    partial_token_ratio: PARTIAL_TOKEN_RATIO,
+    WRatio: TOKEN_WRATIO
+}
+
+
+cdef class TokenCorpus:
+    """
+    Corpus of choices, which are compared to queries using the token based
+    scorers of fuzz.
+
+    Parameters
+    ----------
+    choices : Iterable
+        list of all strings queries should be compared with. None is skipped
+    processor : Callable, optional
+        Optional callable that reformats the strings. utils.default_process
+        is used by default, which lowercases the strings and trims whitespace.
+        The processor is applied to the choices only once.
+
+    Notes
+    -----
+    The scorers usually split both strings into words and sort them on every
+    call. The corpus splits each choice only once and interns every word
+    into an integer id. The ids are assigned in the order of the sorted words,
+    so each choice is stored as a sorted array of ids and the intersection and
+    differences between the words of the query and a choice are calculated by
+    merging two integer arrays. Only the strings passed to fuzz.ratio or
+    fuzz.partial_ratio are built from the words. The results are the same as
+    the ones of process.extract.
+
+    Examples
+    --------
+    >>> from rapidfuzz import process, fuzz
+    >>> corpus = process.TokenCorpus(["new york mets", "new york yankees", "atlanta braves"])
+    >>> corpus.extract("mets new york", scorer=fuzz.token_set_ratio, limit=2)
+    [('new york mets', 100.0, 0), ('new york yankees', 76.19047619047619, 1)]
+    """
+    cdef CppTokenCorpus corpus
+    cdef list choices
+    cdef list indices
+    cdef object processor
+
+    def __init__(self, choices, *, processor=default_process):
+        if processor is True:
+            processor = default_process
+        elif not callable(processor):
+            processor = None
+
+        self.processor = processor
+        self.choices = list(choices)
+        # index of each element of the corpus in choices, since None is skipped
+        self.indices = []
+        for i, choice in enumerate(self.choices):
+            if choice is None:
+                continue
+
+            proc_choice = processor(choice) if processor is not None else choice
+            if not isinstance(proc_choice, str):
+                raise TypeError("TokenCorpus only supports strings")
+            token_corpus_add(self.corpus, conv_sequence(proc_choice))
+            self.indices.append(i)
+        self.corpus.build()
+
+    def __len__(self):
+        return self.corpus.size()
+
+    @property
+    def token_count(self):
+        """amount of different tokens in the corpus"""
+        return self.corpus.token_count()
+
+    def extract(self, query, *, scorer=WRatio, limit=5, score_cutoff=None, stats=None):
+        """
+        Find the best matches in the corpus
+
+        Parameters
+        ----------
+        query : str
+            string we want to find
+        scorer : Callable, optional
+            One of fuzz.token_sort_ratio, fuzz.token_set_ratio, fuzz.token_ratio,
+            fuzz.partial_token_sort_ratio, fuzz.partial_token_set_ratio,
+            fuzz.partial_token_ratio and fuzz.WRatio. fuzz.WRatio is used by default.
+        limit : int, optional
+            maximum amount of results to return. None returns all results.
+            Defaults to 5
+        score_cutoff : float, optional
+            Optional argument for a score threshold as a float between 0 and 100.
+            Matches with a `similarity < score_cutoff` are ignored. Default is 0,
+            which deactivates this behaviour.
+        stats : dict, optional
+            Optional dict, which the counters of the skipped sub-scorers are
+            added to. WRatio and token_ratio calculate an upper bound for the
+            score of each sub-scorer from the string lengths and skip it, when
+            the bound can not reach the score_cutoff or the best score found
+            so far. The keys are `wratio_calls`, `ratio_skipped`,
+            `partial_ratio_skipped`, `token_ratio_skipped`, `token_sort_skipped`
+            and `token_set_skipped`.
+
+        Returns
+        -------
+        List[Tuple[str, float, int]]
+            The best matches in form of a Tuple with 3 elements `(choice, score, index)`
+            sorted by score. Matches with the same score are sorted by their index.
+        """
+        cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+        cdef size_t c_limit = self.corpus.size() if limit is None else limit
+        cdef vector[TokenMatch] matches
+        cdef TokenScorerStats c_stats
+        cdef proc_string c_query
+        cdef size_t i
+
+        if scorer not in token_corpus_scorers:
+            raise ValueError("scorer is not supported by TokenCorpus")
+        cdef int c_scorer = token_corpus_scorers[scorer]
+
+        if c_score_cutoff < 0 or c_score_cutoff > 100:
+            raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
+
+        if query is None:
+            return []
+
+        if self.processor is not None:
+            query = self.processor(query)
+        if not isinstance(query, str):
+            raise TypeError("TokenCorpus only supports strings")
+        c_query = conv_sequence(query)
+
+        with nogil:
+            matches = token_corpus_extract(self.corpus, c_query, c_scorer, c_limit, c_score_cutoff, c_stats)
+
+        if stats is not None:
+            for key, value in (
+                ("wratio_calls", c_stats.wratio_calls),
+                ("ratio_skipped", c_stats.ratio_skipped),
+                ("partial_ratio_skipped", c_stats.partial_ratio_skipped),
+                ("token_ratio_skipped", c_stats.token_ratio_skipped),
+                ("token_sort_skipped", c_stats.token_sort_skipped),
+                ("token_set_skipped", c_stats.token_set_skipped)
+            ):
+                stats[key] = stats.get(key, 0) + value
+
+        results = []
+        for i in range(matches.size()):
+            index = self.indices[matches[i].index]
+            results.append((self.choices[index], matches[i].score, index))
+        return results
+
+    def extractOne(self, query, *, scorer=WRatio, score_cutoff=None, stats=None):
+        """
+        Find the best match in the corpus. When multiple choices have the
+        same score, the first one is returned.
+
+        Parameters
+        ----------
+        query : str
+            string we want to find
+        scorer : Callable, optional
+            scorer used to compare the query with the choices. See `extract`
+            for the supported scorers. fuzz.WRatio is used by default.
+        score_cutoff : float, optional
+            Optional argument for a score threshold as a float between 0 and 100.
+            Matches with a `similarity < score_cutoff` are ignored. Default is 0,
+            which deactivates this behaviour.
+        stats : dict, optional
+            Optional dict, which the counters of the skipped sub-scorers are
+            added to. See `extract`.
+
+        Returns
+        -------
+        Tuple[str, float, int]
+            The best match in form of a Tuple `(choice, score, index)`
+        None
+            When there is no choice with a `similarity >= score_cutoff`
+        """
+        result = self.extract(query, scorer=scorer, limit=1, score_cutoff=score_cutoff, stats=stats)
+        return result[0] if result else None
+
+
+cdef CppMappedCorpusWriter* mapped_corpus_build(choices, processor, length_index) except NULL:
+    """
+    processes the choices and collects them in a writer, which has to be
+    deleted by the caller
+    """
+    cdef uint32_t flags = 0
+    cdef CppMappedCorpusWriter* writer
+    cdef proc_string c_key
+    cdef proc_string c_choice
+
+    if processor is True:
+        processor = default_process
+    elif not callable(processor):
+        processor = None
+
+    if processor is not None:
+        flags |= MAPPED_CORPUS_CHOICES
+    if processor is default_process:
+        flags |= MAPPED_CORPUS_DEFAULT_PROCESS
+    if length_index:
+        flags |= MAPPED_CORPUS_LENGTH_INDEX
+
+    writer = new CppMappedCorpusWriter(flags)
+    try:
+        for i, choice in enumerate(choices):
+            if choice is None:
+                continue
+
+            proc_choice = processor(choice) if processor is not None else choice
+            if not isinstance(choice, str) or not isinstance(proc_choice, str):
+                raise TypeError("MappedCorpus only supports strings")
+            c_key = conv_sequence(proc_choice)
+            c_choice = conv_sequence(choice)
+            mapped_corpus_add(writer[0], c_key, c_choice, i)
+    except BaseException:
+        del writer
+        raise
+    return writer
+
+
+cdef class MappedCorpus:
+    """
+    Corpus of choices, which is stored in a file and mapped into memory.
+    The file is written once using `MappedCorpus.write`.
+
+    Parameters
+    ----------
+    path : str or os.PathLike
+        path of a file written by `MappedCorpus.write`
+
+    Notes
+    -----
+    For large lists of choices building the list and processing the choices
+    in every process can take longer than the searches. The file stores the
+    processed choices in a table with the offset, length and kind of each
+    string, followed by their packed code units. Opening the file maps it
+    read only into memory and only validates its header, so there is no
+    parse step, and the pages are loaded when they are accessed and shared
+    through the page cache by all processes that open the same file. The
+    choices are compared directly inside the mapping using the scorers
+    implemented in C++, so the results are the same as the ones of
+    process.extract with the processed choices.
+
+    When the file has a length index, the choices whose length can not reach
+    the score_cutoff are skipped without reading them for fuzz.ratio,
+    fuzz.QRatio, string_metric.normalized_indel, string_metric.levenshtein,
+    string_metric.indel and string_metric.lcs_seq.
+
+    The file must not be modified while it is opened, since the mapping would
+    change as well. `MappedCorpus.write` replaces the file atomically instead.
+
+    Examples
+    --------
+    >>> from rapidfuzz import process, fuzz
+    >>> process.MappedCorpus.write("teams.rfc", ["Atlanta Falcons", "New York Jets", "New York Giants"])
+    >>> corpus = process.MappedCorpus("teams.rfc")
+    >>> corpus.extractOne("new york jets", scorer=fuzz.ratio)
+    ('New York Jets', 100.0, 1)
+    """
+    cdef CppMappedCorpus corpus
+    cdef readonly object path
+    # searches running without the GIL, which prevent close
+    cdef size_t searches
+
+    def __init__(self, path):
+        self.path = os.fspath(path)
+        self.corpus.open(os.fsencode(self.path))
+
+    @staticmethod
+    def write(path, choices, *, processor=default_process, length_index=True):
+        """
+        Process the choices and store them in a corpus file
+
+        Parameters
+        ----------
+        path : str or os.PathLike
+            path of the file. An existing file is replaced atomically, so
+            processes which have it opened keep their version
+        choices : Iterable
+            list of all strings queries should be compared with. None is skipped
+        processor : Callable, optional
+            Optional callable that reformats the strings. utils.default_process
+            is used by default, which lowercases the strings and trims whitespace.
+            The processor is applied to the choices only once when writing the
+            file. When a processor is used, the original choices are stored as
+            well, so they can be returned as results.
+        length_index : bool, optional
+            Store the positions of the choices sorted by their length using 4
+            bytes per choice, so searches can skip choices by their length.
+            Defaults to True
+        """
+        path = os.fspath(path)
+        tmp_path = "{}.{}.tmp".format(path, os.getpid())
+        cdef CppMappedCorpusWriter* writer = mapped_corpus_build(choices, processor, length_index)
+        try:
+            writer.write(os.fsencode(tmp_path))
+            os.replace(tmp_path, path)
+        except BaseException:
+            if os.path.exists(tmp_path):
+                os.remove(tmp_path)
+            raise
+        finally:
+            del writer
+
+    def close(self):
+        """
+        Unmap the file. The corpus can not be used afterwards
+        """
+        if self.searches:
+            raise RuntimeError("MappedCorpus can not be closed during a search")
+        self.corpus.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    @property
+    def has_length_index(self):
+        """whether the file has a length index"""
+        return self.corpus.has_length_index()
+
+    def __len__(self):
+        return self.corpus.size()
+
+    def __getitem__(self, index):
+        cdef size_t size = self.corpus.size()
+        if index < 0:
+            index += size
+        if not 0 <= index < size:
+            raise IndexError("MappedCorpus index out of range")
+        return mapped_corpus_choice(self.corpus, index)
+
+    cdef _check_open(self):
+        if not self.corpus.is_open():
+            raise ValueError("MappedCorpus is closed")
+
+    def extract(self, query, *, scorer=WRatio, processor=None, limit=5, score_cutoff=None, **kwargs):
+        """
+        Find the best matches in the corpus
+
+        Parameters
+        ----------
+        query : str
+            string we want to find
+        scorer : Callable, optional
+            Any of the scorers of fuzz and string_metric except for
+            fuzz.partial_ratio_alignment. fuzz.WRatio is used by default.
+        processor : Callable or bool, optional
+            Optional callable that is applied to the query. By default the
+            query is processed with utils.default_process, when the choices
+            were processed with it, and is not processed otherwise.
+        limit : int, optional
+            maximum amount of results to return. None returns all results.
+            Defaults to 5
+        score_cutoff : Any, optional
+            Optional argument for a score threshold. For scorers the matches
+            with a `similarity < score_cutoff`, for distances the matches with
+            a `distance > score_cutoff` are ignored. Same as in process.extract
+        **kwargs : Any, optional
+            any other named parameters are passed to the scorer.
+
+        Returns
+        -------
+        List[Tuple[str, Any, int]]
+            The best matches in form of a Tuple with 3 elements `(choice, score, index)`
+            sorted by score. `index` is the index of the choice in the choices
+            passed to `MappedCorpus.write`. Matches with the same score are
+            sorted by their index.
+        """
+        cdef CachedScorerContext ScorerContext
+        cdef CachedDistanceContext DistanceContext
+        cdef vector[MappedMatch[double]] matches
+        cdef vector[MappedMatch[size_t]] int_matches
+        cdef double c_score_cutoff = 0.0
+        cdef size_t c_max = <size_t>-1
+        cdef size_t c_limit
+        cdef size_t min_len = 0
+        cdef size_t max_len = <size_t>-1
+        cdef size_t query_len
+        cdef proc_string c_query
+        cdef size_t i
+
+        self._check_open()
+        if query is None:
+            return []
+
+        c_limit = self.corpus.size() if limit is None else limit
+
+        if processor is None:
+            if self.corpus.flags() & MAPPED_CORPUS_DEFAULT_PROCESS:
+                query = default_process(query)
+        elif callable(processor):
+            query = processor(query)
+        elif processor:
+            query = default_process(query)
+
+        if not isinstance(query, str):
+            raise TypeError("MappedCorpus only supports strings")
+        c_query = conv_sequence(query)
+        query_len = c_query.length
+
+        if IsIntegratedScorer(scorer):
+            ScorerContext = CachedScorerInit(scorer, c_query, 0, kwargs)
+            if score_cutoff is not None:
+                c_score_cutoff = score_cutoff
+            if c_score_cutoff < 0 or c_score_cutoff > 100:
+                raise TypeError("score_cutoff has to be in the range of 0.0 - 100.0")
+
+            # ratio <= 200 * min(len1, len2) / (len1 + len2)
+            if (scorer is ratio or scorer is QRatio or scorer is normalized_indel) and c_score_cutoff > 0:
+                min_len = <size_t>(c_score_cutoff * query_len / (200 - c_score_cutoff))
+                max_len = <size_t>(query_len * (200 - c_score_cutoff) / c_score_cutoff) + 1
+
+            self.searches += 1
+            try:
+                with nogil:
+                    matches = mapped_corpus_extract(self.corpus, ScorerContext, c_limit, c_score_cutoff, query_len, min_len, max_len)
+            finally:
+                self.searches -= 1
+
+            return [
+                (mapped_corpus_choice(self.corpus, matches[i].index), matches[i].score, self.corpus.index(matches[i].index))
+                for i in range(matches.size())
+            ]
+
+        if IsIntegratedDistance(scorer):
+            DistanceContext = CachedDistanceInit(scorer, c_query, 0, kwargs)
+            if score_cutoff is not None and score_cutoff != -1:
+                c_max = score_cutoff
+
+            # every differing character costs at least one insertion or deletion
+            if c_max != <size_t>-1 and (scorer is levenshtein or scorer is indel):
+                weights = kwargs.get("weights", (1, 1, 1)) if scorer is levenshtein else (1, 1)
+                if min(weights[0], weights[1]) > 0:
+                    length_diff = c_max // min(weights[0], weights[1])
+                    min_len = query_len - length_diff if query_len > length_diff else 0
+                    max_len = min(query_len + length_diff, <size_t>-1)
+
+            self.searches += 1
+            try:
+                with nogil:
+                    int_matches = mapped_corpus_extract_distance(self.corpus, DistanceContext, c_limit, c_max, query_len, min_len, max_len)
+            finally:
+                self.searches -= 1
+
+        elif IsIntegratedSimilarity(scorer):
+            DistanceContext = CachedSimilarityInit(scorer, c_query, 0, kwargs)
+            # the similarity is at most the length of the shorter string
+            if score_cutoff is not None:
+                min_len = score_cutoff
+            c_max = similarity_to_max(min_len)
+
+            self.searches += 1
+            try:
+                with nogil:
+                    int_matches = mapped_corpus_extract_similarity(self.corpus, DistanceContext, c_limit, c_max, query_len, min_len, max_len)
+            finally:
+                self.searches -= 1
+
+            return [
+                (mapped_corpus_choice(self.corpus, int_matches[i].index), <size_t>-2 - int_matches[i].score,
+                 self.corpus.index(int_matches[i].index))
+                for i in range(int_matches.size())
+            ]
+
+        else:
+            raise ValueError("scorer is not supported by MappedCorpus")
+
+        return [
+            (mapped_corpus_choice(self.corpus, int_matches[i].index), int_matches[i].score,
+             self.corpus.index(int_matches[i].index))
+            for i in range(int_matches.size())
+        ]
+
+    def extractOne(self, query, *, scorer=WRatio, processor=None, score_cutoff=None, **kwargs):
+        """
+        Find the best match in the corpus. When multiple choices have the
+        same score, the first one is returned.
+
+        Parameters
+        ----------
+        query : str
+            string we want to find
+        scorer : Callable, optional
+            scorer used to compare the query with the choices. See `extract`
+            for the supported scorers. fuzz.WRatio is used by default.
+        processor : Callable or bool, optional
+            Optional callable that is applied to the query. See `extract`
+        score_cutoff : Any, optional
+            Optional argument for a score threshold. See `extract`
+        **kwargs : Any, optional
+            any other named parameters are passed to the scorer.
+
+        Returns
+        -------
+        Tuple[str, Any, int]
+            The best match in form of a Tuple `(choice, score, index)`
+        None
+            When there is no choice reaching the score_cutoff
+        """
+        result = self.extract(query, scorer=scorer, processor=processor, limit=1, score_cutoff=score_cutoff, **kwargs)
+        return result[0] if result else None
+
+
+cdef class NativeCorpus(MappedCorpus):
+    """
+    Corpus of choices, which is stored in native memory in the format of
+    MappedCorpus. It supports the same searches as MappedCorpus.
+
+    Parameters
+    ----------
+    choices : Iterable
+        list of all strings queries should be compared with. None is skipped
+    processor : Callable, optional
+        Optional callable that reformats the strings. utils.default_process
+        is used by default, which lowercases the strings and trims whitespace.
+        The processor is applied to the choices only once.
+    length_index : bool, optional
+        Store the positions of the choices sorted by their length, so
+        searches can skip choices by their length. Defaults to True
+
+    Notes
+    -----
+    process.extract iterates the choices and changes the reference count of
+    every choice, which writes to the memory of the objects. After a fork,
+    e.g. in the prefork model of gunicorn, every page written by a worker is
+    copied, so over time each worker gets a private copy of the choices.
+    NativeCorpus copies the choices once into a single buffer and searches
+    only read this buffer. Python objects are only created for the returned
+    results, which are referenced by their index. So when the corpus is
+    created before forking the workers, its pages stay shared between them.
+
+    Examples
+    --------
+    >>> from rapidfuzz import process, fuzz
+    >>> corpus = process.NativeCorpus(["Atlanta Falcons", "New York Jets", "New York Giants"])
+    >>> corpus.extract("new york", scorer=fuzz.ratio, limit=2)
+    [('New York Jets', 76.19047619047619, 1), ('New York Giants', 69.56521739130434, 2)]
+    """
+
+    def __init__(self, choices, *, processor=default_process, length_index=True):
+        cdef CppMappedCorpusWriter* writer = mapped_corpus_build(choices, processor, length_index)
+        try:
+            self.corpus.load(writer[0])
+        finally:
+            del writer
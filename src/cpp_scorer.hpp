@@ -14,6 +14,22 @@ SIMPLE_RATIO_DEF(QRatio)
 SIMPLE_DISTANCE_DEF(hamming)
 SIMPLE_RATIO_DEF(normalized_hamming)
 SIMPLE_RATIO_DEF(jaro_similarity)
+SIMPLE_DISTANCE_DEF(osa)
+SIMPLE_RATIO_DEF(normalized_osa)
+SIMPLE_DISTANCE_DEF(damerau_levenshtein)
+SIMPLE_RATIO_DEF(normalized_damerau_levenshtein)
+SIMPLE_DISTANCE_DEF(indel)
+SIMPLE_RATIO_DEF(normalized_indel)
+
+size_t lcs_seq_no_process(const proc_string& s1, const proc_string& s2, size_t score_cutoff)
+{
+    return lcs_seq_impl_no_process(s1, s2, score_cutoff);
+}
+
+size_t lcs_seq_default_process(const proc_string& s1, const proc_string& s2, size_t score_cutoff)
+{
+    return lcs_seq_impl_default_process(s1, s2, score_cutoff);
+}
 
 PyObject* levenshtein_no_process(const proc_string& s1, const proc_string& s2,
     size_t insertion, size_t deletion, size_t substitution, size_t max)
@@ -33,6 +49,21 @@ PyObject* levenshtein_default_process(const proc_string& s1, const proc_string&
     return dist_to_long(result);
 }
 
+/* returns (size_t)-1 when the distance is larger than max, so it can be
+ * called without the GIL
+ */
+size_t levenshtein_parallel_no_process(const proc_string& s1, const proc_string& s2,
+    size_t max, size_t workers)
+{
+    return levenshtein_parallel_impl_no_process(s1, s2, max, workers);
+}
+
+size_t levenshtein_parallel_default_process(const proc_string& s1, const proc_string& s2,
+    size_t max, size_t workers)
+{
+    return levenshtein_parallel_impl_default_process(s1, s2, max, workers);
+}
+
 double normalized_levenshtein_no_process(const proc_string& s1, const proc_string& s2,
     size_t insertion, size_t deletion, size_t substitution, double score_cutoff)
 {
@@ -69,7 +100,7 @@ std::vector<rapidfuzz::LevenshteinEditOp>
 levenshtein_editops_inner_no_process(const proc_string& s1, const Sentence& s2)
 {
     switch(s1.kind){
-    LIST_OF_CASES(string_metric::levenshtein_editops, no_process)
+    LIST_OF_CASES(detail::levenshtein_editops, no_process)
     }
     assert(false); /* silence any warnings about missing return value */   
 }
@@ -88,7 +119,7 @@ std::vector<rapidfuzz::LevenshteinEditOp>
 levenshtein_editops_inner_default_process(const proc_string& s1, const Sentence& s2)
 {
     switch(s1.kind){
-    LIST_OF_CASES(string_metric::levenshtein_editops, default_process)
+    LIST_OF_CASES(detail::levenshtein_editops, default_process)
     }          
 }
 
@@ -101,3 +132,75 @@ levenshtein_editops_default_process(const proc_string& s1, const proc_string& s2
 }
 
 # undef X_ENUM
+
+/* find_all is only implemented without a processor, since the positions of the
+ * matches have to refer to the text the user has access to. The processor is
+ * applied in Python instead
+ */
+# define X_ENUM(KIND, TYPE, MSVC_TUPLE) \
+    case KIND: return GET_RATIO_FUNC MSVC_TUPLE  (s2, GET_PROCESSOR MSVC_TUPLE <TYPE>(s1), max);
+
+template<typename Sentence>
+std::vector<detail::LevenshteinMatch>
+levenshtein_find_all_inner_no_process(const proc_string& s1, const Sentence& s2, size_t max)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(detail::levenshtein_find_all, no_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+std::vector<detail::LevenshteinMatch>
+levenshtein_find_all_no_process(const proc_string& s1, const proc_string& s2, size_t max)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(levenshtein_find_all_inner_no_process, no_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+# undef X_ENUM
+
+/* partial_ratio_alignment returns the alignment together with the score */
+# define X_ENUM(KIND, TYPE, MSVC_TUPLE) \
+    case KIND: return GET_RATIO_FUNC MSVC_TUPLE  (s2, GET_PROCESSOR MSVC_TUPLE <TYPE>(s1), score_cutoff);
+
+template<typename Sentence>
+detail::ScoreAlignment
+partial_ratio_alignment_inner_no_process(const proc_string& s1, const Sentence& s2, double score_cutoff)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(detail::partial_ratio_alignment, no_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+detail::ScoreAlignment
+partial_ratio_alignment_no_process(const proc_string& s1, const proc_string& s2, double score_cutoff)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(partial_ratio_alignment_inner_no_process, no_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+template<typename Sentence>
+detail::ScoreAlignment
+partial_ratio_alignment_inner_default_process(const proc_string& s1, const Sentence& s2, double score_cutoff)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(detail::partial_ratio_alignment, default_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+detail::ScoreAlignment
+partial_ratio_alignment_default_process(const proc_string& s1, const proc_string& s2, double score_cutoff)
+{
+    switch(s1.kind){
+    LIST_OF_CASES(partial_ratio_alignment_inner_default_process, default_process)
+    }
+    assert(false); /* silence any warnings about missing return value */
+}
+
+# undef X_ENUM
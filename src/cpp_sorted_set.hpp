@@ -0,0 +1,123 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPIDFUZZ_SORTED_SET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace detail {
+
+/* intersection of two sorted arrays without duplicates. For each element of a
+ * and b in_a/in_b is set to 1 when it is part of the intersection and to 0
+ * otherwise, so the caller can build both differences from the marks as well.
+ * Returns the size of the intersection.
+ *
+ * - when one array is a lot shorter, each of its elements is searched in the
+ *   other array using a galloping search, which skips most of the longer array
+ * - otherwise the arrays are merged in blocks of 4 elements. With SSE2 each
+ *   block of a is compared with all 4 rotations of the block of b, so 16 pairs
+ *   are compared using 8 instructions without any branches. Afterwards the block
+ *   with the smaller last element is skipped
+ */
+static inline std::size_t sorted_intersection(const uint32_t* a, std::size_t len_a, const uint32_t* b,
+                                              std::size_t len_b, uint8_t* in_a, uint8_t* in_b)
+{
+    std::fill(in_a, in_a + len_a, uint8_t(0));
+    std::fill(in_b, in_b + len_b, uint8_t(0));
+    if (!len_a || !len_b) {
+        return 0;
+    }
+
+    /* galloping search, when the arrays differ a lot in size */
+    const std::size_t gallop_ratio = 16;
+    if (len_a * gallop_ratio < len_b || len_b * gallop_ratio < len_a) {
+        bool swapped = len_a > len_b;
+        const uint32_t* small = swapped ? b : a;
+        const uint32_t* large = swapped ? a : b;
+        std::size_t len_small = swapped ? len_b : len_a;
+        std::size_t len_large = swapped ? len_a : len_b;
+        uint8_t* in_small = swapped ? in_b : in_a;
+        uint8_t* in_large = swapped ? in_a : in_b;
+
+        std::size_t count = 0;
+        std::size_t lo = 0;
+        for (std::size_t i = 0; i < len_small && lo < len_large; ++i) {
+            /* double the range [lo, lo + bound) until it contains the first element >= small[i] */
+            std::size_t bound = 1;
+            while (lo + bound < len_large && large[lo + bound - 1] < small[i]) {
+                bound *= 2;
+            }
+            std::size_t hi = std::min(lo + bound, len_large);
+
+            lo = static_cast<std::size_t>(std::lower_bound(large + lo, large + hi, small[i]) - large);
+            if (lo < len_large && large[lo] == small[i]) {
+                in_small[i] = 1;
+                in_large[lo] = 1;
+                ++count;
+                ++lo;
+            }
+        }
+        return count;
+    }
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+#ifdef RAPIDFUZZ_SORTED_SET_SSE2
+    while (i + 4 <= len_a && j + 4 <= len_b) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+
+        __m128i vb1 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        __m128i vb2 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128i vb3 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3));
+        __m128i eq0 = _mm_cmpeq_epi32(va, vb);
+        __m128i eq1 = _mm_cmpeq_epi32(va, vb1);
+        __m128i eq2 = _mm_cmpeq_epi32(va, vb2);
+        __m128i eq3 = _mm_cmpeq_epi32(va, vb3);
+
+        __m128i match_a = _mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3));
+        int mask_a = _mm_movemask_ps(_mm_castsi128_ps(match_a));
+
+        if (mask_a) {
+            /* the comparisons are rotated back, so they line up with the elements of b */
+            __m128i match_b = _mm_or_si128(
+                _mm_or_si128(eq0, _mm_shuffle_epi32(eq1, _MM_SHUFFLE(2, 1, 0, 3))),
+                _mm_or_si128(_mm_shuffle_epi32(eq2, _MM_SHUFFLE(1, 0, 3, 2)),
+                             _mm_shuffle_epi32(eq3, _MM_SHUFFLE(0, 3, 2, 1))));
+            int mask_b = _mm_movemask_ps(_mm_castsi128_ps(match_b));
+
+            for (std::size_t k = 0; k < 4; ++k) {
+                in_a[i + k] |= static_cast<uint8_t>((mask_a >> k) & 1);
+                in_b[j + k] |= static_cast<uint8_t>((mask_b >> k) & 1);
+            }
+            count += popcount64(static_cast<uint64_t>(mask_a));
+        }
+
+        uint32_t last_a = a[i + 3];
+        uint32_t last_b = b[j + 3];
+        i += (last_a <= last_b) ? 4 : 0;
+        j += (last_b <= last_a) ? 4 : 0;
+    }
+#endif
+
+    while (i < len_a && j < len_b) {
+        if (a[i] < b[j]) {
+            ++i;
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            in_a[i++] = 1;
+            in_b[j++] = 1;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+} // namespace detail
@@ -5,6 +5,7 @@
 from rapidfuzz.utils import default_process
 from cpp_common cimport proc_string, is_valid_string, convert_string, hash_array, hash_sequence
 from array import array
+from cpython cimport array as carray
 from libcpp.utility cimport move
 from libcpp.vector cimport vector
 from cpython.list cimport PyList_New, PyList_SET_ITEM
@@ -39,16 +40,42 @@ cdef extern from "cpp_scorer.hpp":
     double jaro_similarity_default_process(         const proc_string&, const proc_string&, double) nogil except +
     double jaro_winkler_similarity_no_process(      const proc_string&, const proc_string&, double, double) nogil except +
     double jaro_winkler_similarity_default_process( const proc_string&, const proc_string&, double, double) nogil except +
+    double normalized_osa_no_process(               const proc_string&, const proc_string&, double) nogil except +
+    double normalized_osa_default_process(          const proc_string&, const proc_string&, double) nogil except +
+    double normalized_damerau_levenshtein_no_process(     const proc_string&, const proc_string&, double) nogil except +
+    double normalized_damerau_levenshtein_default_process(const proc_string&, const proc_string&, double) nogil except +
+    double normalized_indel_no_process(             const proc_string&, const proc_string&, double) nogil except +
+    double normalized_indel_default_process(        const proc_string&, const proc_string&, double) nogil except +
 
     object levenshtein_no_process(                  const proc_string&, const proc_string&, size_t, size_t, size_t, size_t) nogil except +
     object levenshtein_default_process(             const proc_string&, const proc_string&, size_t, size_t, size_t, size_t) nogil except +
     object hamming_no_process(                      const proc_string&, const proc_string&, size_t) nogil except +
     object hamming_default_process(                 const proc_string&, const proc_string&, size_t) nogil except +
+    object osa_no_process(                          const proc_string&, const proc_string&, size_t) nogil except +
+    object osa_default_process(                     const proc_string&, const proc_string&, size_t) nogil except +
+    object damerau_levenshtein_no_process(          const proc_string&, const proc_string&, size_t) nogil except +
+    object damerau_levenshtein_default_process(     const proc_string&, const proc_string&, size_t) nogil except +
+    object indel_no_process(                        const proc_string&, const proc_string&, size_t) nogil except +
+    object indel_default_process(                   const proc_string&, const proc_string&, size_t) nogil except +
+    size_t lcs_seq_no_process(                      const proc_string&, const proc_string&, size_t) nogil except +
+    size_t lcs_seq_default_process(                 const proc_string&, const proc_string&, size_t) nogil except +
+
+    size_t levenshtein_parallel_no_process(         const proc_string&, const proc_string&, size_t, size_t) nogil except +
+    size_t levenshtein_parallel_default_process(    const proc_string&, const proc_string&, size_t, size_t) nogil except +
 
     vector[LevenshteinEditOp] levenshtein_editops_no_process(     const proc_string& s1, const proc_string& s2) nogil except +
     vector[LevenshteinEditOp] levenshtein_editops_default_process(const proc_string& s1, const proc_string& s2) nogil except +
 
-def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
+cdef extern from "cpp_scorer.hpp" namespace "detail":
+    ctypedef struct LevenshteinMatch:
+        size_t start
+        size_t end
+        size_t distance
+
+cdef extern from "cpp_scorer.hpp":
+    vector[LevenshteinMatch] levenshtein_find_all_no_process(const proc_string&, const proc_string&, size_t) nogil except +
+
+def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None, workers=1):
     """
     Calculates the minimum number of insertions, deletions, and substitutions
     required to change one sequence into the other according to Levenshtein with custom
@@ -73,6 +100,13 @@ def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
         considered as a result. If the distance is bigger than max,
         -1 is returned instead. Default is None, which deactivates
         this behaviour.
+    workers : int, optional
+        Maximum number of threads used to calculate the uniform Levenshtein
+        distance of two very long strings. -1 uses all available cores.
+        Default is 1, which calculates the distance on the calling thread.
+        The result does not depend on the amount of workers. The value is
+        validated for all weights, but only used for the uniform Levenshtein
+        distance with the weights (1, 1, 1).
 
     Returns
     -------
@@ -106,11 +140,30 @@ def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
         checks all possible edit operations that are possible under
         the threshold `max`. The time complexity of this algorithm is ``O(N)``.
 
+      - If max is > 3, but smaller than the length of the shorter string / 64 after
+        removing the common affix, the diagonal transition algorithm by
+        Ukkonen / Landau and Vishkin is used. It only follows the diagonals of the
+        Levenshtein matrix, that can be reached with up to max edits.
+        The algorithm is described by [5]_ and [6]_. The time complexity of this
+        algorithm is ``O((N+M)max)``.
+
+      - For long strings without a small max the diagonal transition algorithm is
+        probed with a bound of the length of the shorter string / 512 first. When
+        the strings are similar, this calculates the distance a lot faster than
+        the bit-parallel algorithms. Otherwise the probe only costs a small part
+        of the time required by them.
+
       - If the length of the shorter string is ≤ 64 after removing the common affix
         Hyyrös' algorithm is used, which calculates the Levenshtein distance in
         parallel. The algorithm is described by [1]_. The time complexity of this
         algorithm is ``O(N)``.
 
+      - If workers is not 1 and both strings are long enough, the blocks of
+        Myers' algorithm are split into horizontal stripes, which are calculated
+        by separate threads. The threads work on anti-diagonal tiles of the
+        block matrix and pass the horizontal carry bits to the stripe below,
+        so the result is the same as in the single threaded implementation.
+
       - If the length of the shorter string is ≥ 64 after removing the common affix
         a blockwise implementation of Myers' algorithm is used, which calculates
         the Levenshtein distance in parallel (64 characters at a time).
@@ -193,6 +246,10 @@ def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
            "BitPAl: A Bit-Parallel, General Integer-Scoring Sequence
            Alignment Algorithm. Bioinformatics"
            Bioinformatics, Volume 30 (2014): 3166–3173
+    .. [5] Ukkonen, Esko. "Algorithms for approximate string matching."
+           Information and Control 64.1-3 (1985): 100-118.
+    .. [6] Landau, Gad M. & Vishkin, Uzi. "Fast parallel and serial approximate
+           string matching." Journal of Algorithms 10.2 (1989): 157-169.
 
     Examples
     --------
@@ -220,6 +277,17 @@ def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
         insertion, deletion, substitution = weights
 
     cdef size_t c_max = <size_t>-1 if max is None else max
+    cdef size_t c_workers
+
+    if workers == -1:
+        c_workers = 0
+    elif workers < 1:
+        raise ValueError("workers has to be -1 or a positive integer")
+    else:
+        c_workers = workers
+
+    if c_workers != 1 and insertion == deletion == substitution == 1:
+        return _levenshtein_parallel(s1, s2, processor, c_max, c_workers)
 
     if processor is True or processor == default_process:
         return levenshtein_default_process(conv_sequence(s1), conv_sequence(s2), insertion, deletion, substitution, c_max)
@@ -229,6 +297,30 @@ def levenshtein(s1, s2, *, weights=(1,1,1), processor=None, max=None):
 
     return levenshtein_no_process(conv_sequence(s1), conv_sequence(s2), insertion, deletion, substitution, c_max)
 
+cdef _levenshtein_parallel(s1, s2, processor, size_t c_max, size_t c_workers):
+    cdef size_t result
+    cdef proc_string c_s1
+    cdef proc_string c_s2
+
+    if processor is True or processor == default_process:
+        c_s1 = move(conv_sequence(s1))
+        c_s2 = move(conv_sequence(s2))
+        with nogil:
+            result = levenshtein_parallel_default_process(c_s1, c_s2, c_max, c_workers)
+    else:
+        if callable(processor):
+            s1 = processor(s1)
+            s2 = processor(s2)
+
+        c_s1 = move(conv_sequence(s1))
+        c_s2 = move(conv_sequence(s2))
+        with nogil:
+            result = levenshtein_parallel_no_process(c_s1, c_s2, c_max, c_workers)
+
+    if result == <size_t>-1:
+        return -1
+    return result
+
 cdef str levenshtein_edit_type_to_str(LevenshteinEditType edit_type):
     if edit_type == LevenshteinEditType.Insert:
         return "insert"
@@ -274,6 +366,22 @@ def levenshtein_editops(s1, s2, *, processor=None):
     editops : list[]
         edit operations required to turn s1 into s2
 
+    Notes
+    -----
+    The common prefix and suffix of the two strings is removed, since it does
+    not require any edit operations. Afterwards the blockwise implementation of
+    Myers' algorithm [1]_ is used to calculate the Levenshtein matrix. Instead of
+    storing each cell of the matrix only the vertical delta vectors VP and VN of
+    each column are stored. This requires ``2 * N * [M/64]`` machine words of memory
+    and has a time complexity of ``O([M/64]N)``. The edit operations are then
+    recovered by backtracking through these bit vectors.
+
+    References
+    ----------
+    .. [1] Myers, Gene. "A fast bit-vector algorithm for approximate
+           string matching based on dynamic programming."
+           Journal of the ACM (JACM) 46.3 (1999): 395-415.
+
     Examples
     --------
     >>> from rapidfuzz.string_metric import levenshtein_editops
@@ -295,6 +403,157 @@ def levenshtein_editops(s1, s2, *, processor=None):
         levenshtein_editops_no_process(conv_sequence(s1), conv_sequence(s2))
     )
 
+cdef tuple levenshtein_find_all_impl(pattern, text, size_t c_max):
+    cdef proc_string c_pattern = move(conv_sequence(pattern))
+    cdef proc_string c_text = move(conv_sequence(text))
+    cdef vector[LevenshteinMatch] matches
+    cdef size_t i
+
+    with nogil:
+        matches = levenshtein_find_all_no_process(c_pattern, c_text, c_max)
+
+    cdef carray.array starts = carray.clone(array("Q"), <Py_ssize_t>matches.size(), zero=False)
+    cdef carray.array ends = carray.clone(array("Q"), <Py_ssize_t>matches.size(), zero=False)
+    cdef carray.array distances = carray.clone(array("Q"), <Py_ssize_t>matches.size(), zero=False)
+    for i in range(matches.size()):
+        starts.data.as_ulonglongs[i] = matches[i].start
+        ends.data.as_ulonglongs[i] = matches[i].end
+        distances.data.as_ulonglongs[i] = matches[i].distance
+
+    return starts, ends, distances
+
+def find_all(pattern, text, *, processor=None, max=None):
+    """
+    Find all approximate occurrences of pattern in text.
+
+    Parameters
+    ----------
+    pattern : str
+        String to search for.
+    text : str
+        String to search in.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        searching. When processor is True ``utils.default_process``
+        is used. The positions refer to the processed text.
+        Default is None, which deactivates this behaviour.
+    max : int or None, optional
+        Maximum Levenshtein distance between the pattern and an occurrence.
+        It is limited to ``len(pattern) - 1``, so each occurrence contains
+        at least one character of the pattern. Default is None, which uses
+        this limit.
+
+    Returns
+    -------
+    starts, ends, distances : array.array
+        Three arrays of the typecode "Q" with one element per occurrence.
+        ``text[starts[i]:ends[i]]`` has a Levenshtein distance of ``distances[i]``
+        to the pattern. The occurrences are sorted by their end position.
+
+    Notes
+    -----
+    The text is scanned once using Sellers' algorithm [1]_, which calculates
+    the minimum Levenshtein distance between the pattern and any substring ending
+    at each position of the text. It is implemented using the blockwise
+    bit-parallel algorithm by Myers [2]_, so the time complexity is ``O([M/64]N)``.
+    One occurrence is reported for each local minimum of this distance, that
+    is <= max. The start of an occurrence is found by searching backwards from
+    its end, which results in the shortest substring with this distance.
+    The GIL is released while scanning the text.
+
+    References
+    ----------
+    .. [1] Sellers, Peter H. "The theory and computation of evolutionary
+           distances: pattern recognition."
+           Journal of Algorithms 1.4 (1980): 359-373.
+    .. [2] Myers, Gene. "A fast bit-vector algorithm for approximate
+           string matching based on dynamic programming."
+           Journal of the ACM (JACM) 46.3 (1999): 395-415.
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import find_all
+    >>> starts, ends, distances = find_all("needle", "a nedle and a needle", max=1)
+    >>> list(zip(starts, ends, distances))
+    [(2, 7, 1), (14, 20, 0)]
+    """
+    cdef size_t c_max = <size_t>-1 if max is None else max
+
+    if processor is True:
+        processor = default_process
+    if callable(processor):
+        pattern = processor(pattern)
+        text = processor(text)
+
+    return levenshtein_find_all_impl(pattern, text, c_max)
+
+def normalized_find_all(pattern, text, *, processor=None, score_cutoff=None):
+    """
+    Find all approximate occurrences of pattern in text and return
+    their similarity as a normalized score between 0 and 100.
+
+    Parameters
+    ----------
+    pattern : str
+        String to search for.
+    text : str
+        String to search in.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        searching. When processor is True ``utils.default_process``
+        is used. The positions refer to the processed text.
+        Default is None, which deactivates this behaviour.
+    score_cutoff : float, optional
+        Optional argument for a score threshold as a float between 0 and 100.
+        Only occurrences with a similarity >= score_cutoff are returned.
+        Default is 0, which returns all occurrences with a similarity > 0.
+
+    Returns
+    -------
+    starts, ends, scores : array.array
+        The start and end positions as arrays of the typecode "Q" and the
+        scores as an array of the typecode "d". The score of an occurrence is
+        ``100 - 100 * distance / len(pattern)``.
+
+    See Also
+    --------
+    find_all : Find all occurrences using the Levenshtein distance
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import normalized_find_all
+    >>> starts, ends, scores = normalized_find_all("needle", "a nedle and a needle", score_cutoff=80)
+    >>> list(zip(starts, ends, scores))
+    [(2, 7, 83.33333333333333), (14, 20, 100.0)]
+    """
+    cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+    cdef size_t c_max
+    cdef size_t i
+
+    if processor is True:
+        processor = default_process
+    if callable(processor):
+        pattern = processor(pattern)
+        text = processor(text)
+
+    cdef size_t pattern_len = len(pattern)
+    if not pattern_len or c_score_cutoff > 100:
+        return array("Q"), array("Q"), array("d")
+
+    # largest distance with a score >= score_cutoff
+    c_max = <size_t>(pattern_len * (1.0 - c_score_cutoff / 100))
+    while c_max and 100.0 - 100.0 * c_max / pattern_len < c_score_cutoff:
+        c_max -= 1
+    while c_max + 1 < pattern_len and 100.0 - 100.0 * (c_max + 1) / pattern_len >= c_score_cutoff:
+        c_max += 1
+
+    starts, ends, distances = levenshtein_find_all_impl(pattern, text, c_max)
+    cdef carray.array scores = carray.clone(array("d"), len(distances), zero=False)
+    for i in range(len(distances)):
+        scores.data.as_doubles[i] = 100.0 - 100.0 * distances[i] / pattern_len
+
+    return starts, ends, scores
+
 def normalized_levenshtein(s1, s2, *, weights=(1,1,1), processor=None, score_cutoff=None):
     """
     Calculates a normalized levenshtein distance using custom
@@ -575,4 +834,353 @@ def jaro_winkler_similarity(s1, s2, *, double prefix_weight=0.1, processor=None,
         s1 = processor(s1)
         s2 = processor(s2)
 
-    return jaro_winkler_similarity_no_process(conv_sequence(s1), conv_sequence(s2), prefix_weight, c_score_cutoff)
\ No newline at end of file
+    return jaro_winkler_similarity_no_process(conv_sequence(s1), conv_sequence(s2), prefix_weight, c_score_cutoff)
+
+
+def osa(s1, s2, *, processor=None, max=None):
+    """
+    Calculates the optimal string alignment (OSA) distance between two strings.
+    This is the minimum number of insertions, deletions, substitutions and
+    transpositions of two adjacent characters required to change one string
+    into the other, under the restriction that no substring is edited more
+    than once. It is often referred to as restricted Damerau-Levenshtein distance.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    max : int or None, optional
+        Maximum distance between s1 and s2, that is
+        considered as a result. If the distance is bigger than max,
+        -1 is returned instead. Default is None, which deactivates
+        this behaviour.
+
+    Returns
+    -------
+    distance : int
+        distance between s1 and s2
+
+    Notes
+    -----
+    The distance is calculated using the bit-parallel algorithm described
+    by [1]_. The time complexity of this algorithm is ``O([N/64]M)``.
+
+    References
+    ----------
+    .. [1] Hyyrö, Heikki. "A Bit-Vector Algorithm for Computing
+           Levenshtein and Damerau Edit Distances."
+           Nordic Journal of Computing, Volume 10 (2003): 29-39.
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import osa
+    >>> osa("CA", "AC")
+    1
+    >>> osa("CA", "ABC")
+    3
+    """
+    cdef size_t c_max = <size_t>-1 if max is None else max
+
+    if processor is True or processor == default_process:
+        return osa_default_process(conv_sequence(s1), conv_sequence(s2), c_max)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return osa_no_process(conv_sequence(s1), conv_sequence(s2), c_max)
+
+
+def normalized_osa(s1, s2, *, processor=None, score_cutoff=None):
+    """
+    Calculates a normalized optimal string alignment (OSA) distance.
+    The distance is normalized using the length of the longer string.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    score_cutoff : float, optional
+        Optional argument for a score threshold as a float between 0 and 100.
+        For ratio < score_cutoff 0 is returned instead. Default is 0,
+        which deactivates this behaviour.
+
+    Returns
+    -------
+    similarity : float
+        similarity between s1 and s2 as a float between 0 and 100
+
+    See Also
+    --------
+    osa : optimal string alignment distance
+    """
+    cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+
+    if s1 is None or s2 is None:
+        return 0
+
+    if processor is True or processor == default_process:
+        return normalized_osa_default_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return normalized_osa_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+
+
+def damerau_levenshtein(s1, s2, *, processor=None, max=None):
+    """
+    Calculates the Damerau-Levenshtein distance between two strings.
+    This is the minimum number of insertions, deletions, substitutions and
+    transpositions of two adjacent characters required to change one string
+    into the other. Different to the optimal string alignment distance
+    a substring can be edited after a transposition.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    max : int or None, optional
+        Maximum distance between s1 and s2, that is
+        considered as a result. If the distance is bigger than max,
+        -1 is returned instead. Default is None, which deactivates
+        this behaviour.
+
+    Returns
+    -------
+    distance : int
+        distance between s1 and s2
+
+    Notes
+    -----
+    The distance is calculated using the algorithm described by [1]_, which
+    only stores two rows of the matrix and the last occurence of each character.
+    The time complexity of this algorithm is ``O(NM)`` and it requires
+    ``O(N)`` memory.
+
+    References
+    ----------
+    .. [1] Zhao, Chunchun & Sahni, Sartaj. "Linear space string correction
+           algorithm using the Damerau-Levenshtein distance."
+           BMC Bioinformatics 21.1 (2020): 1-17.
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import damerau_levenshtein
+    >>> damerau_levenshtein("CA", "AC")
+    1
+    >>> damerau_levenshtein("CA", "ABC")
+    2
+    """
+    cdef size_t c_max = <size_t>-1 if max is None else max
+
+    if processor is True or processor == default_process:
+        return damerau_levenshtein_default_process(conv_sequence(s1), conv_sequence(s2), c_max)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return damerau_levenshtein_no_process(conv_sequence(s1), conv_sequence(s2), c_max)
+
+
+def normalized_damerau_levenshtein(s1, s2, *, processor=None, score_cutoff=None):
+    """
+    Calculates a normalized Damerau-Levenshtein distance.
+    The distance is normalized using the length of the longer string.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    score_cutoff : float, optional
+        Optional argument for a score threshold as a float between 0 and 100.
+        For ratio < score_cutoff 0 is returned instead. Default is 0,
+        which deactivates this behaviour.
+
+    Returns
+    -------
+    similarity : float
+        similarity between s1 and s2 as a float between 0 and 100
+
+    See Also
+    --------
+    damerau_levenshtein : Damerau-Levenshtein distance
+    """
+    cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+
+    if s1 is None or s2 is None:
+        return 0
+
+    if processor is True or processor == default_process:
+        return normalized_damerau_levenshtein_default_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return normalized_damerau_levenshtein_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+
+
+def indel(s1, s2, *, processor=None, max=None):
+    """
+    Calculates the minimum number of insertions and deletions
+    required to change one sequence into the other. This is equivalent to the
+    Levenshtein distance with a substitution weight of 2.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    max : int or None, optional
+        Maximum distance between s1 and s2, that is
+        considered as a result. If the distance is bigger than max,
+        -1 is returned instead. Default is None, which deactivates
+        this behaviour.
+
+    Returns
+    -------
+    distance : int
+        distance between s1 and s2
+
+    Notes
+    -----
+    The distance is calculated by the same implementation as
+    ``levenshtein(s1, s2, weights=(1,1,2))``, so the notes on the InDel distance
+    in `levenshtein` apply. It is equal to ``len(s1) + len(s2) - 2 * lcs_seq(s1, s2)``.
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import indel
+    >>> indel("lewenstein", "levenshtein")
+    3
+    """
+    cdef size_t c_max = <size_t>-1 if max is None else max
+
+    if processor is True or processor == default_process:
+        return indel_default_process(conv_sequence(s1), conv_sequence(s2), c_max)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return indel_no_process(conv_sequence(s1), conv_sequence(s2), c_max)
+
+
+def normalized_indel(s1, s2, *, processor=None, score_cutoff=None):
+    """
+    Calculates a normalized InDel distance. The distance is normalized
+    using the sum of the lengths of both strings, so this is the same
+    similarity as ``fuzz.ratio``.
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    score_cutoff : float, optional
+        Optional argument for a score threshold as a float between 0 and 100.
+        For ratio < score_cutoff 0 is returned instead. Default is 0,
+        which deactivates this behaviour.
+
+    Returns
+    -------
+    similarity : float
+        similarity between s1 and s2 as a float between 0 and 100
+
+    See Also
+    --------
+    indel : InDel distance
+    """
+    cdef double c_score_cutoff = 0.0 if score_cutoff is None else score_cutoff
+
+    if s1 is None or s2 is None:
+        return 0
+
+    if processor is True or processor == default_process:
+        return normalized_indel_default_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return normalized_indel_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+
+
+def lcs_seq(s1, s2, *, processor=None, score_cutoff=None):
+    """
+    Calculates the length of the longest common subsequence of two strings
+
+    Parameters
+    ----------
+    s1 : str
+        First string to compare.
+    s2 : str
+        Second string to compare.
+    processor: bool or callable, optional
+        Optional callable that is used to preprocess the strings before
+        comparing them. When processor is True ``utils.default_process``
+        is used. Default is None, which deactivates this behaviour.
+    score_cutoff : int or None, optional
+        Minimum length of the longest common subsequence, that is
+        considered as a result. If the similarity is smaller than score_cutoff,
+        0 is returned instead. Default is None, which deactivates
+        this behaviour.
+
+    Returns
+    -------
+    similarity : int
+        length of the longest common subsequence of s1 and s2
+
+    See Also
+    --------
+    indel : InDel distance
+
+    Examples
+    --------
+    >>> from rapidfuzz.string_metric import lcs_seq
+    >>> lcs_seq("lewenstein", "levenshtein")
+    9
+    """
+    cdef size_t c_score_cutoff = 0 if score_cutoff is None else score_cutoff
+
+    if s1 is None or s2 is None:
+        return 0
+
+    if processor is True or processor == default_process:
+        return lcs_seq_default_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
+    elif callable(processor):
+        s1 = processor(s1)
+        s2 = processor(s2)
+
+    return lcs_seq_no_process(conv_sequence(s1), conv_sequence(s2), c_score_cutoff)
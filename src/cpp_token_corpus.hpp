@@ -0,0 +1,614 @@
+#pragma once
+#include "cpp_bitparallel.hpp"
+#include "cpp_indel.hpp"
+#include "cpp_partial_ratio.hpp"
+#include "cpp_sorted_set.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace detail {
+
+/* same characters as str.isspace in Python */
+static inline bool is_space(uint64_t ch)
+{
+    switch (ch) {
+    case 0x0009: case 0x000A: case 0x000B: case 0x000C: case 0x000D:
+    case 0x001C: case 0x001D: case 0x001E: case 0x001F: case 0x0020:
+    case 0x0085: case 0x00A0: case 0x1680:
+    case 0x2000: case 0x2001: case 0x2002: case 0x2003: case 0x2004: case 0x2005:
+    case 0x2006: case 0x2007: case 0x2008: case 0x2009: case 0x200A:
+    case 0x2028: case 0x2029: case 0x202F: case 0x205F: case 0x3000:
+        return true;
+    }
+    return false;
+}
+
+enum TokenScorer {
+    TOKEN_SORT_RATIO,
+    TOKEN_SET_RATIO,
+    TOKEN_RATIO,
+    PARTIAL_TOKEN_SORT_RATIO,
+    PARTIAL_TOKEN_SET_RATIO,
+    PARTIAL_TOKEN_RATIO,
+    TOKEN_WRATIO
+};
+
+struct TokenMatch {
+    std::size_t index;
+    double score;
+};
+
+/* how often a sub-scorer was skipped, since an upper bound of its score
+ * could not reach the score_cutoff
+ */
+struct TokenScorerStats {
+    TokenScorerStats()
+      : wratio_calls(0), ratio_skipped(0), partial_ratio_skipped(0), token_ratio_skipped(0),
+        token_sort_skipped(0), token_set_skipped(0) {}
+
+    std::size_t wratio_calls;
+    /* ratio of the texts in WRatio */
+    std::size_t ratio_skipped;
+    /* partial_ratio of the texts in WRatio */
+    std::size_t partial_ratio_skipped;
+    /* token_ratio/partial_token_ratio in WRatio */
+    std::size_t token_ratio_skipped;
+    /* ratio of the sorted tokens in token_ratio */
+    std::size_t token_sort_skipped;
+    /* ratio of the differences in token_set_ratio/token_ratio */
+    std::size_t token_set_skipped;
+};
+
+/* upper bound for the normalized indel similarity of two strings, since
+ * the distance is at least the length difference
+ */
+static inline double normalized_indel_bound(std::size_t len1, std::size_t len2, double score_cutoff)
+{
+    std::size_t diff = (len1 > len2) ? len1 - len2 : len2 - len1;
+    return norm_distance(diff, len1 + len2, score_cutoff);
+}
+
+/* corpus of choices for the token based scorers of fuzz. Every token of the
+ * corpus is interned into a dense uint32_t id, which is assigned in the
+ * lexicographical order of the tokens. So each choice can be stored as a
+ * sorted array of ids and the set operations between the query and a choice
+ * are intersections of two sorted integer arrays. The characters of a token are only
+ * accessed to build the strings, which are compared using ratio/partial_ratio.
+ */
+class TokenCorpus {
+public:
+    static const uint32_t unknown_token = static_cast<uint32_t>(-1);
+
+    TokenCorpus() : m_built(false)
+    {
+        m_text_offsets.push_back(0);
+        m_choice_offsets.push_back(0);
+        m_choice_set_offsets.push_back(0);
+    }
+
+    /* add a choice to the corpus. Has to be called before build */
+    template <typename Sentence>
+    void add(const Sentence& choice)
+    {
+        if (m_built) {
+            throw std::logic_error("TokenCorpus can not be modified after building it");
+        }
+
+        std::u32string token;
+        for (std::size_t i = 0; i <= choice.size(); ++i) {
+            if (i == choice.size() || is_space(char_key(choice[i]))) {
+                if (!token.empty()) {
+                    auto it = m_dict.insert(std::make_pair(token, static_cast<uint32_t>(m_dict.size()))).first;
+                    m_choice_tokens.push_back(it->second);
+                    token.clear();
+                }
+            } else {
+                token.push_back(static_cast<char32_t>(choice[i]));
+            }
+
+            if (i < choice.size()) {
+                m_texts.push_back(static_cast<char32_t>(choice[i]));
+            }
+        }
+
+        if (m_dict.size() >= unknown_token) {
+            throw std::length_error("TokenCorpus can only store up to 2^32 - 1 different tokens");
+        }
+
+        m_text_offsets.push_back(m_texts.size());
+        m_choice_offsets.push_back(m_choice_tokens.size());
+    }
+
+    /* renumber the tokens in lexicographical order and sort the tokens of each choice */
+    void build()
+    {
+        std::vector<const std::u32string*> tokens(m_dict.size());
+        for (const auto& elem : m_dict) {
+            tokens[elem.second] = &elem.first;
+        }
+
+        std::vector<uint32_t> order(tokens.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return *tokens[a] < *tokens[b]; });
+
+        std::vector<uint32_t> rank(tokens.size());
+        m_tokens.resize(tokens.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            rank[order[i]] = static_cast<uint32_t>(i);
+            m_tokens[i] = tokens[order[i]];
+        }
+
+        for (auto& elem : m_dict) {
+            elem.second = rank[elem.second];
+        }
+
+        for (std::size_t choice = 0; choice < size(); ++choice) {
+            auto first = m_choice_tokens.begin() + static_cast<std::ptrdiff_t>(m_choice_offsets[choice]);
+            auto last = m_choice_tokens.begin() + static_cast<std::ptrdiff_t>(m_choice_offsets[choice + 1]);
+            for (auto it = first; it != last; ++it) {
+                *it = rank[*it];
+            }
+            std::sort(first, last);
+            std::unique_copy(first, last, std::back_inserter(m_choice_set));
+            m_choice_set_offsets.push_back(m_choice_set.size());
+
+            std::size_t joined_len = (first != last) ? static_cast<std::size_t>(last - first) - 1 : 0;
+            for (auto it = first; it != last; ++it) {
+                joined_len += m_tokens[*it]->size();
+            }
+            m_joined_lengths.push_back(joined_len);
+        }
+
+        m_built = true;
+    }
+
+    std::size_t size() const
+    {
+        return m_choice_offsets.size() - 1;
+    }
+
+    std::size_t token_count() const
+    {
+        return m_tokens.size();
+    }
+
+    /* best `limit` choices sorted by score and index. A bounded heap is used,
+     * so the score of the worst result is used as score_cutoff for the
+     * remaining choices, once `limit` results are found. The skipped
+     * sub-scorers are counted in stats
+     */
+    template <typename Sentence>
+    std::vector<TokenMatch> extract(const Sentence& query, TokenScorer scorer, std::size_t limit,
+                                    double score_cutoff, TokenScorerStats& stats) const
+    {
+        auto comp = [](const TokenMatch& a, const TokenMatch& b) {
+            return (a.score != b.score) ? a.score > b.score : a.index < b.index;
+        };
+
+        std::vector<TokenMatch> matches;
+        if (!limit || score_cutoff > 100) {
+            return matches;
+        }
+
+        Query q = prepare_query(query);
+        Decomposition d;
+        std::priority_queue<TokenMatch, std::vector<TokenMatch>, decltype(comp)> heap(comp);
+        for (std::size_t choice = 0; choice < size(); ++choice) {
+            double score = this->score(q, choice, scorer, score_cutoff, d, stats);
+            if (score < score_cutoff) {
+                continue;
+            }
+
+            heap.push({choice, score});
+            if (heap.size() > limit) {
+                heap.pop();
+            }
+            if (heap.size() == limit) {
+                score_cutoff = std::max(score_cutoff, heap.top().score);
+            }
+        }
+
+        while (!heap.empty()) {
+            matches.push_back(heap.top());
+            heap.pop();
+        }
+        std::reverse(matches.begin(), matches.end());
+        return matches;
+    }
+
+private:
+    struct Query {
+        std::u32string text;
+        /* sorted tokens joined by whitespaces */
+        std::u32string joined;
+        std::size_t word_count;
+        /* sorted and deduplicated tokens and their ids */
+        std::vector<std::u32string> set_tokens;
+        std::vector<uint32_t> set_ids;
+        /* sorted ids of the tokens, that are part of the corpus */
+        std::vector<uint32_t> known_ids;
+        /* ids of all sorted tokens. Empty when a token is not part of the corpus */
+        std::vector<uint32_t> ids;
+    };
+
+    /* set decomposition of the query and a choice into the intersection and the differences */
+    struct Decomposition {
+        std::size_t sect_words;
+        std::size_t sect_len;
+        std::size_t ab_words;
+        std::size_t ba_words;
+        std::u32string diff_ab;
+        std::u32string diff_ba;
+        std::u32string joined;
+        /* marks set by sorted_intersection */
+        std::vector<uint8_t> in_query;
+        std::vector<uint8_t> in_choice;
+    };
+
+    template <typename Sentence>
+    Query prepare_query(const Sentence& query) const
+    {
+        Query q;
+        std::vector<std::u32string> tokens;
+        std::u32string token;
+        for (std::size_t i = 0; i <= query.size(); ++i) {
+            if (i == query.size() || is_space(char_key(query[i]))) {
+                if (!token.empty()) {
+                    tokens.push_back(token);
+                    token.clear();
+                }
+            } else {
+                token.push_back(static_cast<char32_t>(query[i]));
+            }
+
+            if (i < query.size()) {
+                q.text.push_back(static_cast<char32_t>(query[i]));
+            }
+        }
+
+        std::sort(tokens.begin(), tokens.end());
+        q.word_count = tokens.size();
+        bool known = true;
+        for (const auto& t : tokens) {
+            append_token(q.joined, t);
+
+            auto it = m_dict.find(t);
+            uint32_t id = (it != m_dict.end()) ? it->second : unknown_token;
+            known = known && id != unknown_token;
+            q.ids.push_back(id);
+
+            if (q.set_tokens.empty() || q.set_tokens.back() != t) {
+                q.set_tokens.push_back(t);
+                q.set_ids.push_back(id);
+                if (id != unknown_token) {
+                    q.known_ids.push_back(id);
+                }
+            }
+        }
+
+        if (!known) {
+            q.ids.clear();
+        }
+        return q;
+    }
+
+    static void append_token(std::u32string& joined, const std::u32string& token)
+    {
+        if (!joined.empty()) {
+            joined.push_back(U' ');
+        }
+        joined += token;
+    }
+
+    const uint32_t* choice_begin(std::size_t choice) const
+    {
+        return m_choice_tokens.data() + m_choice_offsets[choice];
+    }
+
+    const uint32_t* choice_end(std::size_t choice) const
+    {
+        return m_choice_tokens.data() + m_choice_offsets[choice + 1];
+    }
+
+    std::u32string choice_text(std::size_t choice) const
+    {
+        return m_texts.substr(m_text_offsets[choice], m_text_offsets[choice + 1] - m_text_offsets[choice]);
+    }
+
+    /* sorted tokens of the choice joined by whitespaces */
+    void join_choice(std::size_t choice, std::u32string& joined) const
+    {
+        joined.clear();
+        for (const uint32_t* it = choice_begin(choice); it != choice_end(choice); ++it) {
+            append_token(joined, *m_tokens[*it]);
+        }
+    }
+
+    /* the known ids of the query and the deduplicated ids of the choice are
+     * intersected using sorted_intersection. Both differences are built from
+     * the marks it sets. Tokens, that are not part of the corpus, are always
+     * part of diff_ab
+     */
+    void decompose(const Query& q, std::size_t choice, Decomposition& d) const
+    {
+        d.sect_len = d.ab_words = d.ba_words = 0;
+        d.diff_ab.clear();
+        d.diff_ba.clear();
+
+        const uint32_t* set = m_choice_set.data() + m_choice_set_offsets[choice];
+        std::size_t set_len = m_choice_set_offsets[choice + 1] - m_choice_set_offsets[choice];
+        d.in_query.resize(q.known_ids.size());
+        d.in_choice.resize(set_len);
+        d.sect_words = sorted_intersection(q.known_ids.data(), q.known_ids.size(), set, set_len,
+                                           d.in_query.data(), d.in_choice.data());
+
+        std::size_t known = 0;
+        for (std::size_t i = 0; i < q.set_ids.size(); ++i) {
+            if (q.set_ids[i] != unknown_token && d.in_query[known++]) {
+                d.sect_len += q.set_tokens[i].size();
+            } else {
+                append_token(d.diff_ab, q.set_tokens[i]);
+                d.ab_words++;
+            }
+        }
+
+        for (std::size_t i = 0; i < set_len; ++i) {
+            if (!d.in_choice[i]) {
+                append_token(d.diff_ba, *m_tokens[set[i]]);
+                d.ba_words++;
+            }
+        }
+
+        /* whitespaces between the words of the intersection */
+        if (d.sect_words) {
+            d.sect_len += d.sect_words - 1;
+        }
+    }
+
+    bool same_tokens(const Query& q, std::size_t choice) const
+    {
+        std::size_t len = m_choice_offsets[choice + 1] - m_choice_offsets[choice];
+        return !q.ids.empty() && q.ids.size() == len && std::equal(q.ids.begin(), q.ids.end(), choice_begin(choice));
+    }
+
+    double token_sort_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d) const
+    {
+        if (same_tokens(q, choice)) {
+            return 100;
+        }
+
+        join_choice(choice, d.joined);
+        return normalized_indel(q.joined, d.joined, score_cutoff);
+    }
+
+    double partial_token_sort_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d) const
+    {
+        if (same_tokens(q, choice)) {
+            return 100;
+        }
+
+        join_choice(choice, d.joined);
+        return partial_ratio(q.joined, d.joined, score_cutoff);
+    }
+
+    /* ratio of the differences and ratio of the intersection with each difference,
+     * which is shared by token_set_ratio and token_ratio
+     */
+    double token_set_ratio_impl(const Decomposition& d, double score_cutoff, TokenScorerStats& stats) const
+    {
+        std::size_t ab_len = d.diff_ab.size();
+        std::size_t ba_len = d.diff_ba.size();
+        std::size_t sect_len = d.sect_len;
+
+        /* string length sect+ab <-> sect and sect+ba <-> sect */
+        std::size_t sect_ab_len = sect_len + static_cast<std::size_t>(sect_len != 0) + ab_len;
+        std::size_t sect_ba_len = sect_len + static_cast<std::size_t>(sect_len != 0) + ba_len;
+
+        double result = 0;
+        std::size_t cutoff_distance = score_cutoff_to_distance(score_cutoff, sect_ab_len + sect_ba_len);
+        std::size_t len_diff = (ab_len > ba_len) ? ab_len - ba_len : ba_len - ab_len;
+        if (len_diff > cutoff_distance) {
+            stats.token_set_skipped++;
+        } else {
+            std::size_t dist = indel_distance(d.diff_ab, d.diff_ba, cutoff_distance);
+            if (dist <= cutoff_distance) {
+                result = norm_distance(dist, sect_ab_len + sect_ba_len, score_cutoff);
+            }
+        }
+
+        /* the other ratios are 0 */
+        if (!sect_len) {
+            return result;
+        }
+
+        /* since only the intersection is similar, the distance is the length difference */
+        std::size_t sect_ab_dist = static_cast<std::size_t>(sect_len != 0) + ab_len;
+        double sect_ab_ratio = norm_distance(sect_ab_dist, sect_len + sect_ab_len, score_cutoff);
+
+        std::size_t sect_ba_dist = static_cast<std::size_t>(sect_len != 0) + ba_len;
+        double sect_ba_ratio = norm_distance(sect_ba_dist, sect_len + sect_ba_len, score_cutoff);
+
+        return std::max({result, sect_ab_ratio, sect_ba_ratio});
+    }
+
+    double token_set_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d,
+                           TokenScorerStats& stats) const
+    {
+        /* in FuzzyWuzzy this returns 0. For sake of compatibility return 0 here as well */
+        if (q.set_ids.empty() || choice_begin(choice) == choice_end(choice)) {
+            return 0;
+        }
+
+        decompose(q, choice, d);
+        /* one sentence is part of the other one */
+        if (d.sect_words && (!d.ab_words || !d.ba_words)) {
+            return 100;
+        }
+
+        return token_set_ratio_impl(d, score_cutoff, stats);
+    }
+
+    double token_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d,
+                       TokenScorerStats& stats) const
+    {
+        if (score_cutoff > 100) {
+            return 0;
+        }
+
+        decompose(q, choice, d);
+        if (d.sect_words && (!d.ab_words || !d.ba_words)) {
+            return 100;
+        }
+
+        /* the sorted tokens of the choice are only joined, when their ratio can reach score_cutoff */
+        double result = 0;
+        if (!normalized_indel_bound(q.joined.size(), m_joined_lengths[choice], score_cutoff)) {
+            stats.token_sort_skipped++;
+        } else {
+            join_choice(choice, d.joined);
+            result = normalized_indel(q.joined, d.joined, score_cutoff);
+        }
+        return std::max(result, token_set_ratio_impl(d, std::max(score_cutoff, result), stats));
+    }
+
+    double partial_token_set_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d) const
+    {
+        if (q.set_ids.empty() || choice_begin(choice) == choice_end(choice)) {
+            return 0;
+        }
+
+        decompose(q, choice, d);
+        /* exit early when there is a common word in both sequences */
+        if (d.sect_words) {
+            return 100;
+        }
+
+        return partial_ratio(d.diff_ab, d.diff_ba, score_cutoff);
+    }
+
+    double partial_token_ratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d) const
+    {
+        if (score_cutoff > 100) {
+            return 0;
+        }
+
+        decompose(q, choice, d);
+        /* exit early when there is a common word in both sequences */
+        if (d.sect_words) {
+            return 100;
+        }
+
+        join_choice(choice, d.joined);
+        double result = partial_ratio(q.joined, d.joined, score_cutoff);
+
+        /* do not calculate the same partial_ratio twice */
+        std::size_t word_count = m_choice_offsets[choice + 1] - m_choice_offsets[choice];
+        if (q.word_count == d.ab_words && word_count == d.ba_words) {
+            return result;
+        }
+
+        score_cutoff = std::max(score_cutoff, result);
+        return std::max(result, partial_ratio(d.diff_ab, d.diff_ba, score_cutoff));
+    }
+
+    double wratio(const Query& q, std::size_t choice, double score_cutoff, Decomposition& d,
+                  TokenScorerStats& stats) const
+    {
+        const double UNBASE_SCALE = 0.95;
+
+        stats.wratio_calls++;
+        std::u32string text = choice_text(choice);
+        std::size_t len1 = q.text.size();
+        std::size_t len2 = text.size();
+
+        /* in FuzzyWuzzy this returns 0. For sake of compatibility return 0 here as well */
+        if (!len1 || !len2) {
+            return 0;
+        }
+
+        double len_ratio = (len1 > len2) ? static_cast<double>(len1) / static_cast<double>(len2)
+                                         : static_cast<double>(len2) / static_cast<double>(len1);
+
+        double end_ratio = 0;
+        if (!normalized_indel_bound(len1, len2, score_cutoff)) {
+            stats.ratio_skipped++;
+        } else {
+            end_ratio = normalized_indel(q.text, text, score_cutoff);
+        }
+
+        /* each sub-scorer is scaled down, so it is skipped when even a score of 100
+         * can not beat score_cutoff or the best score found so far
+         */
+        if (len_ratio < 1.5) {
+            score_cutoff = std::max(score_cutoff, end_ratio) / UNBASE_SCALE;
+            if (score_cutoff > 100) {
+                stats.token_ratio_skipped++;
+                return end_ratio;
+            }
+            return std::max(end_ratio, token_ratio(q, choice, score_cutoff, d, stats) * UNBASE_SCALE);
+        }
+
+        const double PARTIAL_SCALE = (len_ratio < 8.0) ? 0.9 : 0.6;
+
+        score_cutoff = std::max(score_cutoff, end_ratio) / PARTIAL_SCALE;
+        if (score_cutoff > 100) {
+            stats.partial_ratio_skipped++;
+        } else {
+            end_ratio = std::max(end_ratio, partial_ratio(q.text, text, score_cutoff) * PARTIAL_SCALE);
+        }
+
+        score_cutoff = std::max(score_cutoff, end_ratio) / UNBASE_SCALE;
+        if (score_cutoff > 100) {
+            stats.token_ratio_skipped++;
+            return end_ratio;
+        }
+        return std::max(end_ratio, partial_token_ratio(q, choice, score_cutoff, d) * UNBASE_SCALE * PARTIAL_SCALE);
+    }
+
+    double score(const Query& q, std::size_t choice, TokenScorer scorer, double score_cutoff, Decomposition& d,
+                 TokenScorerStats& stats) const
+    {
+        if (score_cutoff > 100) {
+            return 0;
+        }
+
+        switch (scorer) {
+        case TOKEN_SORT_RATIO: return token_sort_ratio(q, choice, score_cutoff, d);
+        case TOKEN_SET_RATIO: return token_set_ratio(q, choice, score_cutoff, d, stats);
+        case TOKEN_RATIO: return token_ratio(q, choice, score_cutoff, d, stats);
+        case PARTIAL_TOKEN_SORT_RATIO: return partial_token_sort_ratio(q, choice, score_cutoff, d);
+        case PARTIAL_TOKEN_SET_RATIO: return partial_token_set_ratio(q, choice, score_cutoff, d);
+        case PARTIAL_TOKEN_RATIO: return partial_token_ratio(q, choice, score_cutoff, d);
+        case TOKEN_WRATIO: return wratio(q, choice, score_cutoff, d, stats);
+        }
+        throw std::logic_error("Reached end of control flow in TokenCorpus::score");
+    }
+
+    bool m_built;
+    /* token -> id and id -> token. The pointers stay valid, since the
+     * elements of an unordered_map are never moved
+     */
+    std::unordered_map<std::u32string, uint32_t> m_dict;
+    std::vector<const std::u32string*> m_tokens;
+    /* sorted token ids of each choice */
+    std::vector<uint32_t> m_choice_tokens;
+    std::vector<std::size_t> m_choice_offsets;
+    /* sorted and deduplicated token ids of each choice */
+    std::vector<uint32_t> m_choice_set;
+    std::vector<std::size_t> m_choice_set_offsets;
+    /* length of the sorted tokens of each choice joined by whitespaces */
+    std::vector<std::size_t> m_joined_lengths;
+    /* text of each choice, which is required by WRatio */
+    std::u32string m_texts;
+    std::vector<std::size_t> m_text_offsets;
+};
+
+} // namespace detail
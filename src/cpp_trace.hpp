@@ -0,0 +1,91 @@
+#pragma once
+#include "Python.h"
+#include <cstddef>
+
+/* Static tracepoints (USDT) of the provider "rapidfuzz". They are only
+ * compiled in when RAPIDFUZZ_USDT is defined, which is done by setup.py when
+ * the environment variable RAPIDFUZZ_TRACEPOINTS is set and requires
+ * <sys/sdt.h> (systemtap-sdt-dev). Otherwise the functions are empty and
+ * removed by the compiler. An enabled tracepoint costs a nop and the evaluation
+ * of its arguments, until a tracer attaches to it:
+ *
+ *   perf buildid-cache --add cpp_process.*.so && perf record -e sdt_rapidfuzz:extract__start ...
+ *   bpftrace -e 'usdt:cpp_process.*.so:rapidfuzz:extract__start { @s[tid] = nsecs }
+ *                usdt:cpp_process.*.so:rapidfuzz:extract__end { @ns = hist(nsecs - @s[tid]) }'
+ *
+ * The tracepoints are:
+ *   extract__start(function, choice count)  function is one of TraceFunction, the
+ *                                            count is 0 for iterators without a length
+ *   extract__end(function, result count)
+ *   batch__start(count)                      scoring a chunk of choices with ratio_batch
+ *   batch__end(count)
+ *   scorer_init__start(query length)         construction of a cached scorer
+ *   scorer_init__end()
+ *   sort__start(result count)                sorting the results of extract
+ *   sort__end(limit)
+ */
+#ifdef RAPIDFUZZ_USDT
+#include <sys/sdt.h>
+#define RAPIDFUZZ_PROBE0(name) DTRACE_PROBE(rapidfuzz, name)
+#define RAPIDFUZZ_PROBE1(name, a) DTRACE_PROBE1(rapidfuzz, name, a)
+#define RAPIDFUZZ_PROBE2(name, a, b) DTRACE_PROBE2(rapidfuzz, name, a, b)
+#else
+#define RAPIDFUZZ_PROBE0(name) ((void)0)
+#define RAPIDFUZZ_PROBE1(name, a) ((void)(a))
+#define RAPIDFUZZ_PROBE2(name, a, b) ((void)(a), (void)(b))
+#endif
+
+enum TraceFunction {
+    TRACE_EXTRACT_ONE,
+    TRACE_EXTRACT
+};
+
+static inline void trace_extract_start(int function, PyObject* choices)
+{
+#ifdef RAPIDFUZZ_USDT
+    Py_ssize_t choice_count = PyObject_LengthHint(choices, 0);
+    if (choice_count < 0) {
+        PyErr_Clear();
+        choice_count = 0;
+    }
+    RAPIDFUZZ_PROBE2(extract__start, function, choice_count);
+#else
+    (void)function;
+    (void)choices;
+#endif
+}
+
+static inline void trace_extract_end(int function, std::size_t result_count)
+{
+    RAPIDFUZZ_PROBE2(extract__end, function, result_count);
+}
+
+static inline void trace_batch_start(std::size_t count)
+{
+    RAPIDFUZZ_PROBE1(batch__start, count);
+}
+
+static inline void trace_batch_end(std::size_t count)
+{
+    RAPIDFUZZ_PROBE1(batch__end, count);
+}
+
+static inline void trace_scorer_init_start(std::size_t query_length)
+{
+    RAPIDFUZZ_PROBE1(scorer_init__start, query_length);
+}
+
+static inline void trace_scorer_init_end()
+{
+    RAPIDFUZZ_PROBE0(scorer_init__end);
+}
+
+static inline void trace_sort_start(std::size_t result_count)
+{
+    RAPIDFUZZ_PROBE1(sort__start, result_count);
+}
+
+static inline void trace_sort_end(std::size_t limit)
+{
+    RAPIDFUZZ_PROBE1(sort__end, limit);
+}
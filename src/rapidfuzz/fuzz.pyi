@@ -1,4 +1,4 @@
-from typing import Callable, Hashable, Sequence, Optional, Union, overload, TypeVar
+from typing import Callable, Hashable, Sequence, Optional, Union, overload, TypeVar, NamedTuple
 
 _StringType = Sequence[Hashable]
 S1 = TypeVar("S1")
@@ -14,6 +14,18 @@ def partial_ratio(s1: _StringType, s2: _StringType, *, processor: Optional[bool]
 @overload
 def partial_ratio(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> float: ...
 
+class ScoreAlignment(NamedTuple):
+    score: float
+    src_start: int
+    src_end: int
+    dest_start: int
+    dest_end: int
+
+@overload
+def partial_ratio_alignment(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> Optional[ScoreAlignment]: ...
+@overload
+def partial_ratio_alignment(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> Optional[ScoreAlignment]: ...
+
 @overload
 def token_sort_ratio(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = True, score_cutoff: Optional[float] = 0) -> float: ...
 @overload
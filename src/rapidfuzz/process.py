@@ -1,4 +1,4 @@
 # SPDX-License-Identifier: MIT
 # Copyright (C) 2021 Max Bachmann
 
-from rapidfuzz.cpp_process import extract, extractOne, extract_iter
+from rapidfuzz.cpp_process import extract, extractOne, extract_iter, FingerprintCorpus, MultiPatternMatcher, TokenCorpus, MappedCorpus, NativeCorpus
@@ -1,5 +1,7 @@
-from typing import Any, Mapping, Tuple, Callable, Hashable, Sequence, Iterable, Optional, Union, overload, TypeVar, List, Generator
+import os
+from typing import Any, Mapping, Tuple, Callable, Hashable, Sequence, Iterable, Optional, Union, overload, TypeVar, List, Generator, Generic, Dict
 from rapidfuzz.fuzz import WRatio
+from rapidfuzz.utils import default_process
 
 _StringType = Sequence[Hashable]
 S1 = TypeVar("S1")
@@ -13,6 +15,7 @@ def extractOne(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Optional[bool] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Tuple[_StringType, ResultType, int]: ...
 
@@ -23,6 +26,7 @@ def extractOne(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Optional[bool] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Tuple[_StringType, ResultType, Any]: ...
 
@@ -33,6 +37,7 @@ def extractOne(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Tuple[S2, ResultType, int]: ...
 
@@ -43,6 +48,7 @@ def extractOne(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Tuple[S2, ResultType, Any]: ...
 
@@ -54,6 +60,7 @@ def extract(
     processor: Optional[bool] = None,
     limit: Optional[int] = ...,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> List[Tuple[_StringType, ResultType, int]]: ...
 
@@ -66,6 +73,7 @@ def extract(
     processor: Optional[bool] = None,
     limit: Optional[int] = ...,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> List[Tuple[_StringType, ResultType, Any]]: ...
 
@@ -77,6 +85,7 @@ def extract(
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     limit: Optional[int] = ...,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> List[Tuple[S2, ResultType, int]]: ...
 
@@ -87,6 +96,7 @@ def extract(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> List[Tuple[S2, ResultType, Any]]: ...
 
@@ -98,6 +108,7 @@ def extract_iter(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Optional[bool] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Generator[Tuple[_StringType, ResultType, int], None, None]: ...
 
@@ -108,6 +119,7 @@ def extract_iter(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Optional[bool] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Generator[Tuple[_StringType, ResultType, Any], None, None]: ...
 
@@ -118,6 +130,7 @@ def extract_iter(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Generator[Tuple[S2, ResultType, int], None, None]: ...
 
@@ -128,6 +141,53 @@ def extract_iter(
     scorer: Callable[..., ResultType] = WRatio,
     processor: Callable[[Union[S1, S2]], _StringType] = None,
     score_cutoff: Optional[ResultType] = None,
+    stats: Optional[Dict[str, int]] = None,
     **kwargs: Any
 ) -> Generator[Tuple[S2, ResultType, Any], None, None]: ...
 
+
+_FingerprintType = Union[int, bytes]
+
+class FingerprintCorpus:
+    def __init__(self, fingerprints: Iterable[_FingerprintType] = (), *, bits: int = 64) -> None: ...
+    @property
+    def bits(self) -> int: ...
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: int) -> int: ...
+    def add(self, fingerprint: _FingerprintType) -> None: ...
+    def build_index(self, substrings: Optional[int] = None) -> None: ...
+    def extract(self, query: _FingerprintType, *, limit: Optional[int] = 5, max: Optional[int] = None, workers: int = 1) -> List[Tuple[int, int, int]]: ...
+    def extractOne(self, query: _FingerprintType, *, max: Optional[int] = None, workers: int = 1) -> Optional[Tuple[int, int, int]]: ...
+    def extract_radius(self, query: _FingerprintType, radius: int, *, workers: int = 1) -> List[Tuple[int, int, int]]: ...
+
+class MultiPatternMatcher(Generic[S1]):
+    def __init__(self, patterns: Iterable[S1], *, processor: Union[bool, Callable, None] = None) -> None: ...
+    def __len__(self) -> int: ...
+    def match(self, text: S2, *, score_cutoff: Optional[float] = None) -> List[Tuple[S1, float, int, int, int]]: ...
+
+class TokenCorpus:
+    def __init__(self, choices: Iterable[Optional[str]], *, processor: Union[bool, Callable, None] = default_process) -> None: ...
+    def __len__(self) -> int: ...
+    @property
+    def token_count(self) -> int: ...
+    def extract(self, query: Optional[str], *, scorer: Callable = WRatio, limit: Optional[int] = 5, score_cutoff: Optional[float] = None, stats: Optional[Dict[str, int]] = None) -> List[Tuple[str, float, int]]: ...
+    def extractOne(self, query: Optional[str], *, scorer: Callable = WRatio, score_cutoff: Optional[float] = None, stats: Optional[Dict[str, int]] = None) -> Optional[Tuple[str, float, int]]: ...
+
+class MappedCorpus:
+    def __init__(self, path: Union[str, os.PathLike]) -> None: ...
+    @staticmethod
+    def write(path: Union[str, os.PathLike], choices: Iterable[Optional[str]], *, processor: Union[bool, Callable, None] = default_process, length_index: bool = True) -> None: ...
+    @property
+    def path(self) -> str: ...
+    @property
+    def has_length_index(self) -> bool: ...
+    def close(self) -> None: ...
+    def __enter__(self) -> "MappedCorpus": ...
+    def __exit__(self, *args: Any) -> None: ...
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: int) -> str: ...
+    def extract(self, query: Optional[str], *, scorer: Callable[..., ResultType] = WRatio, processor: Union[bool, Callable, None] = None, limit: Optional[int] = 5, score_cutoff: Optional[ResultType] = None, **kwargs: Any) -> List[Tuple[str, ResultType, int]]: ...
+    def extractOne(self, query: Optional[str], *, scorer: Callable[..., ResultType] = WRatio, processor: Union[bool, Callable, None] = None, score_cutoff: Optional[ResultType] = None, **kwargs: Any) -> Optional[Tuple[str, ResultType, int]]: ...
+
+class NativeCorpus(MappedCorpus):
+    def __init__(self, choices: Iterable[Optional[str]], *, processor: Union[bool, Callable, None] = default_process, length_index: bool = True) -> None: ...
@@ -8,5 +8,14 @@ from rapidfuzz.cpp_string_metric import (
     hamming,
     normalized_hamming,
     jaro_similarity,
-    jaro_winkler_similarity
+    jaro_winkler_similarity,
+    osa,
+    normalized_osa,
+    damerau_levenshtein,
+    normalized_damerau_levenshtein,
+    indel,
+    normalized_indel,
+    lcs_seq,
+    find_all,
+    normalized_find_all
 )
@@ -1,13 +1,14 @@
 from typing import Callable, Hashable, Sequence, Optional, Union, overload, TypeVar, Tuple
+from array import array
 
 _StringType = Sequence[Hashable]
 S1 = TypeVar("S1")
 S2 = TypeVar("S2")
 
 @overload
-def levenshtein(s1: _StringType, s2: _StringType, *, weights: Optional[Tuple[int, int, int]] = (1,1,1), processor: Optional[bool] = None, max: Optional[int] = None) -> int: ...
+def levenshtein(s1: _StringType, s2: _StringType, *, weights: Optional[Tuple[int, int, int]] = (1,1,1), processor: Optional[bool] = None, max: Optional[int] = None, workers: int = 1) -> int: ...
 @overload
-def levenshtein(s1: S1, s2: S2, *, weights: Optional[Tuple[int, int, int]] = (1,1,1), processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None) -> int: ...
+def levenshtein(s1: S1, s2: S2, *, weights: Optional[Tuple[int, int, int]] = (1,1,1), processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None, workers: int = 1) -> int: ...
 
 @overload
 def normalized_levenshtein(s1: _StringType, s2: _StringType, *, weights: Optional[Tuple[int, int, int]] = (1,1,1), processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> float: ...
@@ -38,3 +39,48 @@ def jaro_similarity(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _Str
 def jaro_winkler_similarity(s1: _StringType, s2: _StringType, *, prefix_weight: float = 0.1, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> float: ...
 @overload
 def jaro_winkler_similarity(s1: S1, s2: S2, *, prefix_weight: float = 0.1, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> float: ...
+
+@overload
+def osa(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, max: Optional[int] = None) -> int: ...
+@overload
+def osa(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None) -> int: ...
+
+@overload
+def normalized_osa(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> float: ...
+@overload
+def normalized_osa(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> float: ...
+
+@overload
+def damerau_levenshtein(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, max: Optional[int] = None) -> int: ...
+@overload
+def damerau_levenshtein(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None) -> int: ...
+
+@overload
+def normalized_damerau_levenshtein(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> float: ...
+@overload
+def normalized_damerau_levenshtein(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> float: ...
+
+@overload
+def indel(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, max: Optional[int] = None) -> int: ...
+@overload
+def indel(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None) -> int: ...
+
+@overload
+def normalized_indel(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> float: ...
+@overload
+def normalized_indel(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> float: ...
+
+@overload
+def lcs_seq(s1: _StringType, s2: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[int] = None) -> int: ...
+@overload
+def lcs_seq(s1: S1, s2: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[int] = None) -> int: ...
+
+@overload
+def find_all(pattern: _StringType, text: _StringType, *, processor: Optional[bool] = None, max: Optional[int] = None) -> Tuple[array, array, array]: ...
+@overload
+def find_all(pattern: S1, text: S2, *, processor: Callable[[Union[S1, S2]], _StringType], max: Optional[int] = None) -> Tuple[array, array, array]: ...
+
+@overload
+def normalized_find_all(pattern: _StringType, text: _StringType, *, processor: Optional[bool] = None, score_cutoff: Optional[float] = 0) -> Tuple[array, array, array]: ...
+@overload
+def normalized_find_all(pattern: S1, text: S2, *, processor: Callable[[Union[S1, S2]], _StringType], score_cutoff: Optional[float] = 0) -> Tuple[array, array, array]: ...
@@ -109,6 +109,20 @@ def test_empty_string():
     assert fuzz.partial_token_set_ratio("    ", "    ") == 0
 
 
+def test_partial_ratio_alignment():
+    """
+    partial_ratio_alignment returns the positions of the best window
+    """
+    assert fuzz.partial_ratio_alignment("a needle", "this is a needle in a haystack") == (100, 0, 8, 8, 16)
+    assert fuzz.partial_ratio_alignment("this is a needle in a haystack", "a needle") == (100, 8, 16, 0, 8)
+    assert fuzz.partial_ratio_alignment("A NEEDLE", "a needle!", processor=True) == (100, 0, 8, 0, 8)
+    alignment = fuzz.partial_ratio_alignment("physics 2 vid", "study physics physics 2")
+    assert alignment.score == fuzz.partial_ratio("physics 2 vid", "study physics physics 2")
+    assert (alignment.dest_start, alignment.dest_end) == (14, 23)
+    assert fuzz.partial_ratio_alignment("abc", "xyz", score_cutoff=50) is None
+    assert fuzz.partial_ratio_alignment("", "") == (100, 0, 0, 0, 0)
+    assert fuzz.partial_ratio_alignment("test", None) is None
+
 @pytest.mark.parametrize("scorer", scorers)
 def test_invalid_input(scorer):
     """
@@ -1,4 +1,5 @@
 from itertools import product
+from difflib import SequenceMatcher
 from functools import partial
 from string import ascii_letters, digits, punctuation
 
@@ -45,6 +46,114 @@ def levenshtein(s1, s2, weights=(1, 1, 1)):
 
     return dist[-1][-1]
 
+def osa(s1, s2):
+    """
+    python implementation of the optimal string alignment distance
+    """
+    rows = len(s1)+1
+    cols = len(s2)+1
+    dist = [[0 for x in range(cols)] for x in range(rows)]
+
+    for row in range(rows):
+        dist[row][0] = row
+
+    for col in range(cols):
+        dist[0][col] = col
+
+    for row in range(1, rows):
+        for col in range(1, cols):
+            cost = 0 if s1[row-1] == s2[col-1] else 1
+            dist[row][col] = min(
+                dist[row-1][col] + 1,       # deletion
+                dist[row][col-1] + 1,       # insertion
+                dist[row-1][col-1] + cost   # substitution
+            )
+            if row > 1 and col > 1 and s1[row-1] == s2[col-2] and s1[row-2] == s2[col-1]:
+                dist[row][col] = min(dist[row][col], dist[row-2][col-2] + 1) # transposition
+
+    return dist[-1][-1]
+
+def damerau_levenshtein(s1, s2):
+    """
+    python implementation of the unrestricted Damerau-Levenshtein distance
+    """
+    max_dist = len(s1) + len(s2)
+    last_row = {}
+    dist = [[0 for x in range(len(s2)+2)] for x in range(len(s1)+2)]
+
+    dist[0][0] = max_dist
+    for row in range(len(s1)+1):
+        dist[row+1][0] = max_dist
+        dist[row+1][1] = row
+    for col in range(len(s2)+1):
+        dist[0][col+1] = max_dist
+        dist[1][col+1] = col
+
+    for row in range(1, len(s1)+1):
+        last_match_col = 0
+        for col in range(1, len(s2)+1):
+            last_match_row = last_row.get(s2[col-1], 0)
+            prev_match_col = last_match_col
+            cost = 1
+            if s1[row-1] == s2[col-1]:
+                cost = 0
+                last_match_col = col
+            dist[row+1][col+1] = min(
+                dist[row][col] + cost,       # substitution
+                dist[row+1][col] + 1,        # insertion
+                dist[row][col+1] + 1,        # deletion
+                dist[last_match_row][prev_match_col] # transposition
+                    + (row - last_match_row - 1) + 1 + (col - prev_match_col - 1)
+            )
+        last_row[s1[row-1]] = row
+
+    return dist[-1][-1]
+
+def jaro_similarity(s1, s2):
+    """
+    python implementation of the jaro similarity using flag arrays
+    """
+    if not s1 or not s2:
+        return 0
+
+    bound = max(len(s1), len(s2)) // 2
+    bound = bound - 1 if bound else 0
+    s1_flag = [False] * len(s1)
+    s2_flag = [False] * len(s2)
+    common = 0
+    for i, ch in enumerate(s2):
+        for j in range(max(0, i - bound), min(i + bound + 1, len(s1))):
+            if not s1_flag[j] and s1[j] == ch:
+                s1_flag[j] = s2_flag[i] = True
+                common += 1
+                break
+
+    if not common:
+        return 0
+
+    s1_matches = [ch for ch, flag in zip(s1, s1_flag) if flag]
+    s2_matches = [ch for ch, flag in zip(s2, s2_flag) if flag]
+    transpositions = sum(a != b for a, b in zip(s1_matches, s2_matches)) // 2
+    return 100 * (common / len(s1) + common / len(s2) + (common - transpositions) / common) / 3
+
+def partial_ratio(s1, s2):
+    """
+    python implementation of partial_ratio, which scores the window of the
+    longer string aligned to each matching block
+    """
+    if not s1 or not s2:
+        return 100 if not s1 and not s2 else 0
+
+    if len(s1) > len(s2):
+        s1, s2 = s2, s1
+
+    best = 0
+    for block in SequenceMatcher(None, s1, s2, autojunk=False).get_matching_blocks():
+        long_start = max(block.b - block.a, 0)
+        window = s2[long_start:long_start + len(s1)]
+        best = max(best, normalize_distance(levenshtein(s1, window, (1, 1, 2)), s1, window, (1, 1, 2)))
+    return best
+
 def normalize_distance(dist, s1, s2, weights=(1, 1, 1)):
     insert, delete, substitute = weights
     if len(s1) > len(s2):
@@ -120,6 +229,41 @@ def test_partial_ratio(s1, s2):
     fuzz.partial_ratio(s1, s2)
 
 
+@given(s1=st.text(alphabet="abcd", max_size=80), s2=st.text(alphabet="abcd", max_size=200))
+@settings(max_examples=100, deadline=None)
+def test_partial_ratio_windows(s1, s2):
+    """
+    test partial_ratio against a simple python implementation, which
+    scores every candidate window
+    """
+    reference_score = partial_ratio(s1, s2)
+    assert isclose(fuzz.partial_ratio(s1, s2), reference_score)
+    assert isclose(extractOne_scorer(s1, s2, fuzz.partial_ratio), reference_score)
+    # strings with the same length are not necessarily aligned the same way when swapped
+    swapped_score = partial_ratio(s2, s1)
+    assert isclose(fuzz.partial_ratio(s2, s1), swapped_score)
+    assert isclose(extractOne_scorer(s2, s1, fuzz.partial_ratio), swapped_score)
+    assert isclose(extract_iter_scorer(s1, s2, fuzz.partial_ratio), reference_score)
+    for score_cutoff in [50, 80]:
+        expected = reference_score if reference_score >= score_cutoff else 0
+        assert isclose(fuzz.partial_ratio(s1, s2, score_cutoff=score_cutoff), expected)
+
+
+
+@given(s1=st.text(alphabet="abcd", max_size=80), s2=st.text(alphabet="abcd", max_size=200))
+@settings(max_examples=100, deadline=None)
+def test_partial_ratio_alignment(s1, s2):
+    """
+    partial_ratio_alignment returns the score of partial_ratio and the
+    window this score was calculated for
+    """
+    for a, b in [(s1, s2), (s2, s1)]:
+        alignment = fuzz.partial_ratio_alignment(a, b)
+        assert alignment.score == fuzz.partial_ratio(a, b)
+        if a and b:
+            assert isclose(fuzz.ratio(a[alignment.src_start:alignment.src_end],
+                b[alignment.dest_start:alignment.dest_end]), alignment.score)
+
 @given(s1=st.text(), s2=st.text())
 @settings(max_examples=500, deadline=None)
 def test_token_ratio(s1, s2):
@@ -240,6 +384,88 @@ def test_levenshtein_random(s1, s2):
     assert isclose(extract_scorer(     s1, s2, string_metric.normalized_levenshtein, weights=(1,1,2)), reference_sim)
     assert isclose(extract_iter_scorer(s1, s2, string_metric.normalized_levenshtein, weights=(1,1,2)), reference_sim)
 
+@given(s1=st.text(alphabet="abcd"), s2=st.text(alphabet="abcd"))
+@settings(max_examples=500, deadline=None)
+def test_osa(s1, s2):
+    """
+    Test bitparallel optimal string alignment implementation against simple implementation
+    """
+    reference_dist = osa(s1, s2)
+    assert string_metric.osa(s1, s2) == reference_dist
+    assert extractOne_scorer(  s1, s2, string_metric.osa) == reference_dist
+    assert extract_scorer(     s1, s2, string_metric.osa) == reference_dist
+    assert extract_iter_scorer(s1, s2, string_metric.osa) == reference_dist
+
+    reference_sim = normalize_distance(reference_dist, s1, s2)
+    assert isclose(string_metric.normalized_osa(s1, s2), reference_sim)
+    assert isclose(extractOne_scorer(  s1, s2, string_metric.normalized_osa), reference_sim)
+    assert isclose(extract_scorer(     s1, s2, string_metric.normalized_osa), reference_sim)
+    assert isclose(extract_iter_scorer(s1, s2, string_metric.normalized_osa), reference_sim)
+
+@given(s1=st.text(alphabet="abcd"), s2=st.text(alphabet="abcd"))
+@settings(max_examples=500, deadline=None)
+def test_damerau_levenshtein(s1, s2):
+    """
+    Test Damerau-Levenshtein implementation against simple implementation
+    """
+    reference_dist = damerau_levenshtein(s1, s2)
+    assert string_metric.damerau_levenshtein(s1, s2) == reference_dist
+    assert extractOne_scorer(  s1, s2, string_metric.damerau_levenshtein) == reference_dist
+    assert extract_scorer(     s1, s2, string_metric.damerau_levenshtein) == reference_dist
+    assert extract_iter_scorer(s1, s2, string_metric.damerau_levenshtein) == reference_dist
+
+    reference_sim = normalize_distance(reference_dist, s1, s2)
+    assert isclose(string_metric.normalized_damerau_levenshtein(s1, s2), reference_sim)
+    assert isclose(extractOne_scorer(  s1, s2, string_metric.normalized_damerau_levenshtein), reference_sim)
+    assert isclose(extract_scorer(     s1, s2, string_metric.normalized_damerau_levenshtein), reference_sim)
+    assert isclose(extract_iter_scorer(s1, s2, string_metric.normalized_damerau_levenshtein), reference_sim)
+
+@given(s1=st.text(), s2=st.text())
+@settings(max_examples=500, deadline=None)
+def test_indel(s1, s2):
+    """
+    Test bitparallel InDel/LCS implementation against simple implementation
+    """
+    reference_dist = levenshtein(s1, s2, weights=(1,1,2))
+    assert string_metric.indel(s1, s2) == reference_dist
+    assert extractOne_scorer(  s1, s2, string_metric.indel) == reference_dist
+    assert extract_scorer(     s1, s2, string_metric.indel) == reference_dist
+    assert extract_iter_scorer(s1, s2, string_metric.indel) == reference_dist
+
+    reference_sim = normalize_distance(reference_dist, s1, s2, weights=(1,1,2))
+    assert isclose(string_metric.normalized_indel(s1, s2), reference_sim)
+    assert isclose(extractOne_scorer(  s1, s2, string_metric.normalized_indel), reference_sim)
+    assert isclose(extract_scorer(     s1, s2, string_metric.normalized_indel), reference_sim)
+    assert isclose(extract_iter_scorer(s1, s2, string_metric.normalized_indel), reference_sim)
+
+    reference_lcs = (len(s1) + len(s2) - reference_dist) // 2
+    assert string_metric.lcs_seq(s1, s2) == reference_lcs
+    assert extractOne_scorer(  s1, s2, string_metric.lcs_seq) == reference_lcs
+    assert extract_scorer(     s1, s2, string_metric.lcs_seq) == reference_lcs
+    assert extract_iter_scorer(s1, s2, string_metric.lcs_seq) == reference_lcs
+
+@given(s1=st.text(alphabet="abcd", max_size=200), s2=st.text(alphabet="abcd", max_size=200))
+@settings(max_examples=500, deadline=None)
+def test_jaro(s1, s2):
+    """
+    Test bitparallel jaro implementation against simple implementation
+    """
+    reference_sim = jaro_similarity(s1, s2)
+    assert isclose(string_metric.jaro_similarity(s1, s2), reference_sim)
+    assert isclose(extractOne_scorer(  s1, s2, string_metric.jaro_similarity), reference_sim)
+    assert isclose(extract_scorer(     s1, s2, string_metric.jaro_similarity), reference_sim)
+    assert isclose(extract_iter_scorer(s1, s2, string_metric.jaro_similarity), reference_sim)
+
+    prefix = 0
+    while prefix < min(4, len(s1), len(s2)) and s1[prefix] == s2[prefix]:
+        prefix += 1
+    if reference_sim > 70:
+        reference_sim += prefix * 0.1 * (100 - reference_sim)
+    assert isclose(string_metric.jaro_winkler_similarity(s1, s2), reference_sim)
+    assert isclose(extractOne_scorer(  s1, s2, string_metric.jaro_winkler_similarity), reference_sim)
+    assert isclose(extract_scorer(     s1, s2, string_metric.jaro_winkler_similarity), reference_sim)
+    assert isclose(extract_iter_scorer(s1, s2, string_metric.jaro_winkler_similarity), reference_sim)
+
 @given(sentence=st.text())
 @settings(max_examples=200)
 def test_multiple_processor_runs(sentence):
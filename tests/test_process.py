@@ -4,7 +4,7 @@
 import unittest
 import pytest
 
-from rapidfuzz import process, fuzz, utils
+from rapidfuzz import process, fuzz, utils, string_metric
 import pandas as pd
 
 class ProcessTest(unittest.TestCase):
@@ -253,5 +253,340 @@ def test_extractOne_case_sensitive(processor, scorer):
 def test_extractOne_use_first_match(scorer):
     assert process.extractOne("new york mets", ["new york mets", "new york mets"], scorer=scorer)[2] == 0
 
+def test_extract_similarity():
+    """
+    for similarities like lcs_seq a higher score is better
+    """
+    choices = ["abc", "abcdef", "xyz", "abcd"]
+    assert process.extractOne("abcdefg", choices, scorer=string_metric.lcs_seq) == ("abcdef", 6, 1)
+    assert process.extract("abcdefg", choices, scorer=string_metric.lcs_seq, limit=2) == [
+        ("abcdef", 6, 1), ("abcd", 4, 3)]
+    assert process.extract("abcdefg", choices, scorer=string_metric.lcs_seq, score_cutoff=4) == [
+        ("abcdef", 6, 1), ("abcd", 4, 3)]
+    assert process.extractOne("abcdefg", {"a": "abc", "b": "abcd"}, scorer=string_metric.lcs_seq) == ("abcd", 4, "b")
+    assert list(process.extract_iter("abcdefg", choices, scorer=string_metric.lcs_seq, score_cutoff=4)) == [
+        ("abcdef", 6, 1), ("abcd", 4, 3)]
+    assert process.extractOne("abcdefg", ["xyz"], scorer=string_metric.lcs_seq, score_cutoff=1) is None
+
+def test_extract_jaro_winkler_batch():
+    """
+    extract and extractOne score short choices for jaro_winkler_similarity in
+    batches. The results have to be the same as when scoring them one at a time
+    """
+    names = ["Jon Smith", "John Smith", "Jonathan Smyth", None, "Joan Smit",
+        "J. Smith", "Smith John", "John Smithson" * 6, "", "Jane Doe"] * 4
+    scorer = string_metric.jaro_winkler_similarity
+    for score_cutoff in (0, 80, 95):
+        expected = [(name, scorer("John Smith", name), i) for i, name in enumerate(names)
+            if name is not None and scorer("John Smith", name) >= score_cutoff]
+        expected.sort(key=lambda x: (-x[1], x[2]))
+        result = process.extract("John Smith", names, scorer=scorer, processor=None,
+            limit=None, score_cutoff=score_cutoff)
+        assert [(x[0], x[2]) for x in result] == [(x[0], x[2]) for x in expected]
+        assert [x[1] for x in result] == pytest.approx([x[1] for x in expected])
+
+    assert process.extractOne("John Smith", names, scorer=scorer, processor=None) == ("John Smith", 100, 1)
+    assert process.extractOne("Jon Smit", iter(names), scorer=scorer, processor=None)[2] == 0
+    assert process.extractOne("john smith", names, scorer=scorer) == ("John Smith", 100, 1)
+
+def test_extract_hamming_batch():
+    """
+    extract and extractOne score equal-length codes for hamming in batches
+    """
+    query = "0123456789abcdef" * 4
+    codes = [query[:i] + "x" + query[i+1:] for i in range(0, 64, 3)] * 8
+    codes[50] = query
+    codes[70] = None
+    assert process.extractOne(query, codes, scorer=string_metric.hamming) == (query, 0, 50)
+    assert process.extractOne(query, codes[51:], scorer=string_metric.hamming) == (codes[51], 1, 0)
+    result = process.extract(query, codes, scorer=string_metric.hamming, limit=None)
+    assert len(result) == len(codes) - 1
+    assert result[0] == (query, 0, 50)
+    assert process.extract(query, codes, scorer=string_metric.hamming, score_cutoff=0) == [(query, 0, 50)]
+    assert process.extractOne(query, codes, scorer=string_metric.normalized_hamming) == (query, 100, 50)
+    with pytest.raises(ValueError):
+        process.extract(query, codes + ["abc"], scorer=string_metric.hamming)
+
+def test_extract_partial_ratio_alignment():
+    """
+    extract and extractOne return the alignment when partial_ratio_alignment is used
+    """
+    choices = ["a haystack", "A Needle in a haystack", "some needles"]
+    result = process.extract("needle", choices, scorer=fuzz.partial_ratio_alignment)
+    assert [(choice, key) for choice, _, key in result] == [(choices[1], 1), (choices[2], 2), (choices[0], 0)]
+    assert result[0][1] == (100, 0, 6, 2, 8)
+    assert [x[1].score for x in result] == [x[1] for x in process.extract("needle", choices, scorer=fuzz.partial_ratio)]
+    assert process.extractOne("needle", choices, scorer=fuzz.partial_ratio_alignment) == result[0]
+    assert process.extractOne("needle", choices, scorer=fuzz.partial_ratio_alignment, score_cutoff=100,
+        processor=None) == ("some needles", (100, 0, 6, 5, 11), 2)
+    assert process.extractOne("needle", ["xyz"], scorer=fuzz.partial_ratio_alignment, score_cutoff=50) is None
+
+    # the alignment of the scan is the one of partial_ratio_alignment, even for choices shorter than the query
+    choices = {"a": "need", "b": "a needle", "c": None, "d": "eedl"}
+    result = process.extract("needles", choices, scorer=fuzz.partial_ratio_alignment, processor=None, limit=None)
+    assert [key for _, _, key in result] == ["a", "d", "b"]
+    for choice, alignment, _ in result:
+        assert alignment == fuzz.partial_ratio_alignment("needles", choice)
+
+@pytest.mark.parametrize("scorer,score_cutoff", [
+    (fuzz.ratio, 50), (custom_scorer, 50), (string_metric.levenshtein, 2), (string_metric.lcs_seq, 3)])
+def test_extract_stats(scorer, score_cutoff):
+    """
+    the results are the same with and without stats
+    """
+    choices = ["new york mets", None, "new YORK mets", "atlanta braves", "new york yankees", "", "mets"]
+    for processor in (None, lambda s: None if s == "mets" else s):
+        kwargs = dict(scorer=scorer, processor=processor, score_cutoff=score_cutoff)
+        for c in (choices, dict(enumerate(choices))):
+            stats = {}
+            assert process.extract("new york mets", c, limit=None, stats=stats, **kwargs) == \
+                process.extract("new york mets", c, limit=None, **kwargs)
+            assert process.extractOne("new york mets", c, stats={}, **kwargs) == \
+                process.extractOne("new york mets", c, **kwargs)
+            assert list(process.extract_iter("new york mets", c, stats={}, **kwargs)) == \
+                list(process.extract_iter("new york mets", c, **kwargs))
+
+            skipped = 1 if processor is None or scorer is custom_scorer else 2
+            assert stats["choices_skipped"] == skipped
+            assert stats["choices_scanned"] == len(choices) - skipped
+            assert stats["choices_rejected"] >= stats["scorer_early_exits"]
+            assert all(stats[key] >= 0 for key in ("processor_ns", "conversion_ns", "scorer_ns", "result_ns"))
+
+def test_extractOne_stats():
+    """
+    extractOne stops after a perfect match and the statistics are accumulated
+    """
+    stats = {}
+    choices = ["new york", "new york mets", "new york mets", "new york yankees"]
+    assert process.extractOne("new york mets", choices, scorer=fuzz.ratio, stats=stats) == ("new york mets", 100, 1)
+    assert stats["choices_scanned"] == 2
+    assert stats["choices_rejected"] == 0
+    process.extractOne("new york mets", choices, scorer=fuzz.ratio, stats=stats)
+    assert stats["choices_scanned"] == 4
+
+@pytest.mark.parametrize("bits", [64, 128, 256])
+def test_fingerprint_corpus(bits):
+    """
+    FingerprintCorpus returns the same results as a brute force search
+    for scans, multi-threaded scans and multi-index hashing
+    """
+    import random
+    rng = random.Random(bits)
+    base = [rng.getrandbits(bits) for _ in range(16)]
+    # clusters of similar fingerprints, so radius searches have results
+    fingerprints = [b ^ (1 << rng.randrange(bits)) ^ (1 << rng.randrange(bits)) for b in base for _ in range(5000)]
+    corpus = process.FingerprintCorpus(fingerprints, bits=bits)
+    assert len(corpus) == len(fingerprints)
+    assert corpus[-1] == fingerprints[-1]
+
+    def brute_force(query):
+        return sorted(((fp, bin(fp ^ query).count("1"), i) for i, fp in enumerate(fingerprints)), key=lambda x: (x[1], x[2]))
+
+    for query in base[:4] + [rng.getrandbits(bits)]:
+        expected = brute_force(query)
+        for workers in [1, 3, -1]:
+            assert corpus.extract(query, limit=10, workers=workers) == expected[:10]
+            assert corpus.extractOne(query, workers=workers) == expected[0]
+            assert corpus.extract(query, limit=None, max=4, workers=workers) == [x for x in expected if x[1] <= 4]
+            assert corpus.extract_radius(query, 6, workers=workers) == [x for x in expected if x[1] <= 6]
+
+    assert corpus.extractOne(base[0].to_bytes(bits // 8, "big")) == corpus.extractOne(base[0])
+
+    corpus.build_index()
+    for radius in [0, 4, 8, 12]:
+        for query in base[:4]:
+            expected = [x for x in brute_force(query) if x[1] <= radius]
+            assert corpus.extract_radius(query, radius) == expected
+
+    # fingerprints added after building the index are searchable as well
+    corpus.add(base[0])
+    assert corpus.extract_radius(base[0], 0)[-1] == (base[0], 0, len(fingerprints))
+
+def test_fingerprint_corpus_invalid():
+    """
+    FingerprintCorpus validates its arguments
+    """
+    with pytest.raises(ValueError):
+        process.FingerprintCorpus(bits=100)
+    corpus = process.FingerprintCorpus([1, 2, 3])
+    assert corpus.extractOne(0, max=0) is None
+    with pytest.raises(ValueError):
+        corpus.add(1 << 64)
+    with pytest.raises(ValueError):
+        corpus.add(-1)
+    with pytest.raises(ValueError):
+        corpus.add(b"\x00")
+    with pytest.raises(TypeError):
+        corpus.add("abc")
+    with pytest.raises(ValueError):
+        corpus.extract(1, workers=0)
+    with pytest.raises(ValueError):
+        corpus.build_index(65)
+
+def test_multi_pattern_matcher():
+    """
+    MultiPatternMatcher returns the best occurrence found by
+    normalized_find_all for each pattern
+    """
+    import random
+    rng = random.Random(37)
+    # many short patterns share a word, some patterns use multiple blocks
+    patterns = ["".join(rng.choice("abcd") for _ in range(rng.choice([0, 1, 3, 8, 20, 70, 150])))
+        for _ in range(60)]
+    matcher = process.MultiPatternMatcher(patterns)
+    assert len(matcher) == len(patterns)
+
+    for _ in range(20):
+        text = "".join(rng.choice("abcd") for _ in range(rng.randrange(400)))
+        for score_cutoff in [None, 50, 80]:
+            expected = []
+            for index, pattern in enumerate(patterns):
+                starts, ends, scores = string_metric.normalized_find_all(pattern, text, score_cutoff=score_cutoff)
+                if scores:
+                    best = max(range(len(scores)), key=lambda i: (scores[i], -ends[i]))
+                    expected.append((pattern, scores[best], index, starts[best], ends[best]))
+            expected.sort(key=lambda x: (-x[1], x[2]))
+            assert matcher.match(text, score_cutoff=score_cutoff) == expected
+
+def test_multi_pattern_matcher_processor():
+    """
+    the processor is applied to the patterns and the text, while the
+    original patterns are returned
+    """
+    matcher = process.MultiPatternMatcher(["Needle", "PIN"], processor=True)
+    assert matcher.match("A NEDLE and a pin!", score_cutoff=80) == [
+        ("PIN", 100, 1, 14, 17), ("Needle", 100 - 100 / 6, 0, 2, 7)]
+    assert process.MultiPatternMatcher([]).match("abc") == []
+
+@pytest.mark.parametrize("scorer", [fuzz.token_sort_ratio, fuzz.token_set_ratio, fuzz.token_ratio,
+    fuzz.partial_token_sort_ratio, fuzz.partial_token_set_ratio, fuzz.partial_token_ratio, fuzz.WRatio])
+def test_token_corpus(scorer):
+    """
+    TokenCorpus returns the same results as process.extract
+    """
+    import random
+    rng = random.Random(39)
+    words = ["new", "york", "mets", "yankees", "New", "YORK", "atlanta", "braves", "braves!", "met"]
+    choices = [" ".join(rng.choice(words) for _ in range(rng.randrange(6))) for _ in range(200)] + [None]
+    corpus = process.TokenCorpus(choices)
+    assert len(corpus) == 200
+
+    for query in ["new york mets", "Mets New", "yankees yankees", "atlanta", "boston", ""]:
+        for score_cutoff in [None, 50, 90]:
+            expected = process.extract(query, choices, scorer=scorer, limit=None, score_cutoff=score_cutoff)
+            assert corpus.extract(query, scorer=scorer, limit=None, score_cutoff=score_cutoff) == expected
+            assert corpus.extract(query, scorer=scorer, limit=3, score_cutoff=score_cutoff) == expected[:3]
+            assert corpus.extractOne(query, scorer=scorer, score_cutoff=score_cutoff) == \
+                process.extractOne(query, choices, scorer=scorer, score_cutoff=score_cutoff)
+
+def test_token_corpus_invalid():
+    """
+    TokenCorpus validates its arguments
+    """
+    corpus = process.TokenCorpus(["new york mets"])
+    assert corpus.token_count == 3
+    assert corpus.extract(None) == []
+    with pytest.raises(ValueError):
+        corpus.extract("mets", scorer=fuzz.ratio)
+    with pytest.raises(TypeError):
+        process.TokenCorpus(["new york mets"], processor=None).extract(["mets"])
+    with pytest.raises(TypeError):
+        process.TokenCorpus([["new", "york"]], processor=None)
+
+def test_token_corpus_stats():
+    """
+    WRatio skips sub-scorers, which can not reach the score_cutoff
+    """
+    corpus = process.TokenCorpus(["new york mets", "new york mets vs atlanta braves and new york yankees"])
+    stats = {}
+    assert corpus.extractOne("new york mets", stats=stats) == ("new york mets", 100, 0)
+    assert stats["wratio_calls"] == 2
+    # the second choice is more than 1.5 times longer, so its ratio can not reach 100
+    assert stats["ratio_skipped"] == 1
+    assert stats["partial_ratio_skipped"] == 1
+    assert stats["token_ratio_skipped"] == 2
+
+    # the counters are added to the existing values
+    corpus.extract("new york mets", stats=stats)
+    assert stats["wratio_calls"] == 4
+
+@pytest.mark.parametrize("scorer,score_cutoff", [(fuzz.WRatio, 50), (fuzz.ratio, 60), (fuzz.QRatio, None),
+    (string_metric.levenshtein, 2), (string_metric.indel, 3), (string_metric.lcs_seq, 3)])
+def test_mapped_corpus(tmp_path, scorer, score_cutoff):
+    """
+    MappedCorpus returns the same results as process.extract
+    """
+    import random
+    rng = random.Random(49)
+    choices = ["".join(rng.choice("abcAB \u00fc\u20ac\U0001d11e") for _ in range(rng.randrange(12)))
+        for _ in range(300)] + [None]
+    process.MappedCorpus.write(tmp_path / "corpus.rfc", choices)
+    process.MappedCorpus.write(tmp_path / "raw.rfc", choices, processor=None, length_index=False)
+
+    with process.MappedCorpus(tmp_path / "corpus.rfc") as corpus, \
+         process.MappedCorpus(tmp_path / "raw.rfc") as raw:
+        assert len(corpus) == 300
+        assert corpus.has_length_index and not raw.has_length_index
+        assert corpus[1] == choices[1]
+        for query in rng.sample(choices[:300], 10) + ["", "ABC"]:
+            expected = process.extract(query, choices, scorer=scorer, limit=None, score_cutoff=score_cutoff)
+            assert corpus.extract(query, scorer=scorer, limit=None, score_cutoff=score_cutoff) == expected
+            assert corpus.extract(query, scorer=scorer, limit=3, score_cutoff=score_cutoff) == expected[:3]
+            assert corpus.extractOne(query, scorer=scorer, score_cutoff=score_cutoff) == \
+                process.extractOne(query, choices, scorer=scorer, score_cutoff=score_cutoff)
+            assert raw.extract(query, scorer=scorer, limit=3, score_cutoff=score_cutoff) == \
+                process.extract(query, choices, scorer=scorer, processor=None, limit=3, score_cutoff=score_cutoff)
+
+def test_mapped_corpus_invalid(tmp_path):
+    """
+    MappedCorpus validates the file and its arguments
+    """
+    path = tmp_path / "corpus.rfc"
+    process.MappedCorpus.write(path, ["new york mets"])
+    corpus = process.MappedCorpus(path)
+    assert corpus.extract(None) == []
+    with pytest.raises(ValueError):
+        corpus.extract("mets", scorer=fuzz.partial_ratio_alignment)
+    with pytest.raises(TypeError):
+        corpus.extract(["mets"], processor=False)
+    with pytest.raises(TypeError):
+        process.MappedCorpus.write(tmp_path / "list.rfc", [["new", "york"]])
+    assert not (tmp_path / "list.rfc").exists()
+    corpus.close()
+    with pytest.raises(ValueError):
+        corpus.extract("mets")
+
+    with pytest.raises(OSError):
+        process.MappedCorpus(tmp_path / "missing.rfc")
+    (tmp_path / "invalid.rfc").write_bytes(b"RFCORPUS" + bytes(100))
+    with pytest.raises(ValueError):
+        process.MappedCorpus(tmp_path / "invalid.rfc")
+    (tmp_path / "truncated.rfc").write_bytes(path.read_bytes()[:100])
+    with pytest.raises(ValueError):
+        process.MappedCorpus(tmp_path / "truncated.rfc")
+
+@pytest.mark.parametrize("scorer,score_cutoff", [(fuzz.WRatio, None), (fuzz.ratio, 60),
+    (string_metric.levenshtein, 2), (string_metric.lcs_seq, 3)])
+def test_native_corpus(scorer, score_cutoff):
+    """
+    NativeCorpus returns the same results as process.extract
+    """
+    import random
+    rng = random.Random(50)
+    choices = ["".join(rng.choice("abcAB \u00fc\u20ac") for _ in range(rng.randrange(1, 12)))
+        for _ in range(300)] + [None]
+    corpus = process.NativeCorpus(iter(choices))
+    assert len(corpus) == 300 and corpus.path is None
+
+    for query in rng.sample(choices[:300], 10) + ["", "ABC"]:
+        expected = process.extract(query, choices, scorer=scorer, limit=None, score_cutoff=score_cutoff)
+        assert corpus.extract(query, scorer=scorer, limit=None, score_cutoff=score_cutoff) == expected
+        assert corpus.extractOne(query, scorer=scorer, score_cutoff=score_cutoff) == \
+            process.extractOne(query, choices, scorer=scorer, score_cutoff=score_cutoff)
+
+    corpus.close()
+    with pytest.raises(ValueError):
+        corpus.extract("abc")
+
 if __name__ == '__main__':
     unittest.main()
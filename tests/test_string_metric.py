@@ -51,6 +51,42 @@ def test_simple_unicode_tests():
     assert string_metric.levenshtein(s1, s1, weights=(1,1,5)) == 0
     assert string_metric.levenshtein(s1, s1, weights=(3,7,5)) == 0
 
+def test_levenshtein_long_similar_strings():
+    """
+    long strings with a small distance are calculated using the
+    diagonal transition algorithm
+    """
+    s1 = "abcdefghij" * 1000
+    s2 = s1[:1000] + "X" + s1[1001:5000] + "Y" + s1[5001:9000] + "Z" + s1[9000:]
+    assert string_metric.levenshtein(s1, s2) == 3
+    assert string_metric.levenshtein(s1, s2, max=4) == 3
+    assert string_metric.levenshtein(s1, s2 + "abcd", max=7) == 7
+    assert string_metric.levenshtein(s1, s2 + "abcd", max=6) == -1
+    assert string_metric.levenshtein(s1, s2[:8000], max=100) == -1
+
+def test_levenshtein_workers():
+    """
+    the multi threaded implementation has to return the same result as the
+    single threaded implementation
+    """
+    s1 = "abcdefghijklmnopqrstuvwxyz" * 200
+    s2 = "abcdefhijxlmnopqrtuvwyzab" * 220
+    dist = string_metric.levenshtein(s1, s2)
+    assert string_metric.levenshtein(s1, s2, workers=2) == dist
+    assert string_metric.levenshtein(s1, s2, workers=4) == dist
+    assert string_metric.levenshtein(s2, s1, workers=-1) == dist
+    assert string_metric.levenshtein(s1, s2, max=dist, workers=2) == dist
+    assert string_metric.levenshtein(s1, s2, max=dist-1, workers=2) == -1
+    with pytest.raises(ValueError):
+        string_metric.levenshtein(s1, s2, workers=0)
+    # workers is validated for all weights, but only used for uniform weights
+    assert string_metric.levenshtein(s1, s2, weights=(1,1,2), workers=2) == \
+        string_metric.levenshtein(s1, s2, weights=(1,1,2))
+    with pytest.raises(ValueError):
+        string_metric.levenshtein(s1, s2, weights=(1,1,2), workers=0)
+    with pytest.raises(ValueError):
+        string_metric.levenshtein("a", "b", weights=(1,2,3), workers=-2)
+
 def test_levenshtein_editops():
     """
     basic test for levenshtein_editops
@@ -59,6 +95,151 @@ def test_levenshtein_editops():
         ("delete", 1, 0), ("replace", 4, 3), ("insert", 6, 6)
     ]
 
+def apply_editops(editops, s1, s2):
+    """
+    applies the edit operations returned by levenshtein_editops to s1.
+    The positions are the row and column of the operation in the
+    Levenshtein matrix, so deletions and replacements refer to
+    s1[src_pos - 1] and insertions and replacements to s2[dest_pos - 1]
+    """
+    result = []
+    src_pos = 0
+    for op, spos, dpos in editops:
+        if op == "insert":
+            result.append(s1[src_pos:spos])
+            result.append(s2[dpos - 1])
+            src_pos = spos
+        else:
+            result.append(s1[src_pos:spos - 1])
+            if op == "replace":
+                result.append(s2[dpos - 1])
+            src_pos = spos
+    result.append(s1[src_pos:])
+    return "".join(result)
+
+def test_levenshtein_editops_long_strings():
+    """
+    levenshtein_editops uses a blockwise implementation for strings
+    with more than 64 characters. The amount of edit operations has to
+    be the same as the Levenshtein distance and applying them to s1
+    has to result in s2
+    """
+    s1 = "a" * 65 + "bcdefgh" * 30
+    s2 = "b" + "a" * 64 + "bcdxfgh" * 29 + "aaa"
+    for a, b in [(s1, s2), (s2, s1), ("x" * 130, "y" + "x" * 127), ("abc" * 50, "cba" * 45)]:
+        editops = string_metric.levenshtein_editops(a, b)
+        assert len(editops) == string_metric.levenshtein(a, b)
+        assert apply_editops(editops, a, b) == b
+    assert string_metric.levenshtein_editops(s1, s1) == []
+
+def test_osa():
+    """
+    basic test for the optimal string alignment distance
+    """
+    assert string_metric.osa("", "") == 0
+    assert string_metric.osa("CA", "AC") == 1
+    assert string_metric.osa("CA", "ABC") == 3
+    assert string_metric.osa("abcdef", "badcfe") == 3
+    assert string_metric.osa("abcdef", "badcfe", max=2) == -1
+    assert string_metric.osa("a" * 70 + "bc", "a" * 70 + "cb") == 1
+    assert string_metric.normalized_osa("CA", "AC") == 50
+    assert string_metric.normalized_osa("CA", "AC", score_cutoff=60) == 0
+
+def test_damerau_levenshtein():
+    """
+    basic test for the Damerau-Levenshtein distance
+    """
+    assert string_metric.damerau_levenshtein("", "") == 0
+    assert string_metric.damerau_levenshtein("CA", "AC") == 1
+    assert string_metric.damerau_levenshtein("CA", "ABC") == 2
+    assert string_metric.damerau_levenshtein("CA", "ABC", max=1) == -1
+    assert string_metric.damerau_levenshtein(["aa", "bb"], ["bb", "aa"]) == 1
+    assert string_metric.normalized_damerau_levenshtein("CA", "ABC") == pytest.approx(100 / 3)
+
+def test_indel():
+    """
+    indel has to return the same results as levenshtein with weights (1,1,2)
+    """
+    s1 = "lewenstein"
+    s2 = "levenshtein"
+    assert string_metric.indel(s1, s2) == string_metric.levenshtein(s1, s2, weights=(1,1,2))
+    assert string_metric.indel(s1, s2, max=3) == 3
+    assert string_metric.indel(s1, s2, max=2) == -1
+    assert string_metric.normalized_indel(s1, s2) == pytest.approx(
+        string_metric.normalized_levenshtein(s1, s2, weights=(1,1,2)))
+    assert string_metric.normalized_indel(s1, s2, score_cutoff=90) == 0
+
+def test_lcs_seq():
+    """
+    basic test for lcs_seq
+    """
+    assert string_metric.lcs_seq("", "") == 0
+    assert string_metric.lcs_seq("lewenstein", "levenshtein") == 9
+    assert string_metric.lcs_seq("lewenstein", "levenshtein", score_cutoff=10) == 0
+    assert string_metric.lcs_seq("a" * 100 + "b", "b" + "a" * 100) == 100
+    assert string_metric.lcs_seq(["aa", "bb"], ["bb", "cc"]) == 1
+
+def test_jaro_winkler_long_strings():
+    """
+    jaro_similarity uses a blockwise implementation for strings
+    with more than 64 characters
+    """
+    s1 = "abcdefghij" * 20
+    s2 = "abcdefghij" * 15 + "jihgfedcba" * 5
+    assert string_metric.jaro_similarity(s1, s1) == 100
+    assert string_metric.jaro_similarity(s1, s2) == pytest.approx(95.833333)
+    assert string_metric.jaro_winkler_similarity(s1, s2) == pytest.approx(97.5)
+    assert string_metric.jaro_similarity(s1, s2, score_cutoff=96) == 0
+    with pytest.raises(ValueError):
+        string_metric.jaro_winkler_similarity(s1, s2, prefix_weight=0.3)
+
+def test_hamming():
+    """
+    hamming compares 64 bytes at a time. The result has to be the same
+    for all character widths
+    """
+    s1 = "0123456789abcdef" * 32
+    s2 = s1[:100] + "x" + s1[101:300] + "yz" + s1[302:]
+    for a, b in ((s1 + "a", s2 + "b"), (s1 + "ä", s2 + "ö"), (s1 + "😀", s2 + "😁")):
+        assert string_metric.hamming(a, b) == 4
+        assert string_metric.hamming(a, b, max=4) == 4
+        assert string_metric.hamming(a, b, max=3) == -1
+        assert string_metric.normalized_hamming(a, b) == pytest.approx(100 - 400 / len(a))
+
+    assert string_metric.hamming(s1, [ord(x) for x in s2]) == 3
+    assert string_metric.hamming("", "") == 0
+    with pytest.raises(ValueError):
+        string_metric.hamming(s1, s2[1:])
+
+def test_find_all():
+    """
+    find_all reports each approximate occurrence with the shortest
+    substring ending at the local minimum of the distance
+    """
+    text = "a nedle and a needle in a haystack with a neeedle"
+    starts, ends, distances = string_metric.find_all("needle", text, max=1)
+    assert list(zip(starts, ends, distances)) == [(2, 7, 1), (14, 20, 0), (44, 49, 1)]
+    assert list(zip(*string_metric.find_all("needle", text, max=0))) == [(14, 20, 0)]
+    assert list(zip(*string_metric.find_all("abc", "abcabc", max=1))) == [(0, 3, 0), (3, 6, 0)]
+    # periodic texts report every non overlapping occurrence
+    assert list(zip(*string_metric.find_all("aa", "aaaaaa", max=0))) == [(0, 2, 0), (2, 4, 0), (4, 6, 0)]
+    assert list(zip(*string_metric.find_all("aa", "aaaaa", max=0))) == [(0, 2, 0), (2, 4, 0)]
+    assert list(zip(*string_metric.find_all("aaa", "aaaaaaa", max=1))) == [(0, 3, 0), (3, 6, 0)]
+    assert list(zip(*string_metric.find_all("NEEDLE", text, processor=True, max=0))) == [(14, 20, 0)]
+
+    # patterns longer than 64 characters
+    pattern = "the quick brown fox jumps over the lazy dog " * 3
+    text = "x" * 100 + pattern[:50] + pattern[51:] + "y" * 100
+    assert list(zip(*string_metric.find_all(pattern, text, max=5))) == [(100, 100 + len(pattern) - 1, 1)]
+
+    starts, ends, scores = string_metric.normalized_find_all("needle", "a nedle and a needle", score_cutoff=80)
+    assert list(zip(starts, ends)) == [(2, 7), (14, 20)]
+    assert list(scores) == pytest.approx([100 - 100 / 6, 100])
+    assert list(zip(*string_metric.normalized_find_all("needle", "a nedle and a needle", score_cutoff=90))) == [(14, 20, 100)]
+
+    assert [len(x) for x in string_metric.find_all("", "abc")] == [0, 0, 0]
+    assert [len(x) for x in string_metric.find_all("abc", "")] == [0, 0, 0]
+
 def test_help():
     """
     test that all help texts can be printed without throwing an exception,
@@ -71,6 +252,15 @@ def test_help():
     help(string_metric.normalized_hamming)
     help(string_metric.jaro_similarity)
     help(string_metric.jaro_winkler_similarity)
+    help(string_metric.osa)
+    help(string_metric.normalized_osa)
+    help(string_metric.damerau_levenshtein)
+    help(string_metric.normalized_damerau_levenshtein)
+    help(string_metric.indel)
+    help(string_metric.normalized_indel)
+    help(string_metric.lcs_seq)
+    help(string_metric.find_all)
+    help(string_metric.normalized_find_all)
 
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file